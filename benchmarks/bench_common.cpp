@@ -0,0 +1,57 @@
+#pragma once
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief 基准测试公共工具：按下标生成不同类型的元素，以及统一的规模参数
+ */
+
+/**
+ * @brief 生成第 i 个测试元素
+ * \n std::string 使用超过 SSO 长度的字符串，保证每个元素都有一次堆分配
+ */
+template <typename T>
+T makeValue(uint64_t i);
+
+template <>
+inline int makeValue<int>(uint64_t i)
+{
+    return static_cast<int>(i * 2654435761u);
+}
+
+template <>
+inline uint64_t makeValue<uint64_t>(uint64_t i)
+{
+    return i * 11400714819323198485ull;
+}
+
+template <>
+inline std::string makeValue<std::string>(uint64_t i)
+{
+    return "benchmark-value-" + std::to_string(i * 2654435761u);
+}
+
+/**
+ * @brief 生成 n 个测试元素
+ */
+template <typename T>
+std::vector<T> makeValues(uint64_t n)
+{
+    std::vector<T> values;
+    values.reserve(n);
+    for (uint64_t i = 0; i < n; ++i)
+    {
+        values.push_back(makeValue<T>(i));
+    }
+    return values;
+}
+
+/**
+ * @brief 容器规模：8 到 64K，按 8 倍递增
+ */
+inline void sizeArgs(benchmark::internal::Benchmark *b)
+{
+    b->RangeMultiplier(8)->Range(8, 1 << 16);
+}
@@ -0,0 +1,75 @@
+#include <mutex>
+#include "bench_common.cpp"
+#include "../src/stl_vector.cpp"
+#include "../src/stl_concurrent_vector.cpp"
+
+/**
+ * @brief 多线程追加的扩展性：concurrentVector 与加锁的 vectorWarpper 对比
+ * \n 每个线程每次迭代追加一个元素，线程数从 1 到 64，另外单独测 48 线程
+ */
+namespace
+{
+concurrentVector<uint64_t> *g_cv = nullptr;
+vectorWarpper<uint64_t> *g_vw = nullptr;
+std::mutex g_mutex;
+} // namespace
+
+static void BM_ConcurrentVector_PushBack(benchmark::State &state)
+{
+    if (state.thread_index() == 0)
+    {
+        g_cv = new concurrentVector<uint64_t>();
+    }
+    uint64_t v = state.thread_index();
+    for (auto _ : state)
+    {
+        g_cv->push_back(v++);
+    }
+    if (state.thread_index() == 0)
+    {
+        delete g_cv;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_ConcurrentVector_GrowBy(benchmark::State &state)
+{
+    if (state.thread_index() == 0)
+    {
+        g_cv = new concurrentVector<uint64_t>();
+    }
+    for (auto _ : state)
+    {
+        g_cv->grow_by(64, state.thread_index());
+    }
+    if (state.thread_index() == 0)
+    {
+        delete g_cv;
+    }
+    state.SetItemsProcessed(state.iterations() * 64);
+}
+
+static void BM_MutexVectorWarpper_PushBack(benchmark::State &state)
+{
+    if (state.thread_index() == 0)
+    {
+        g_vw = new vectorWarpper<uint64_t>();
+    }
+    uint64_t v = state.thread_index();
+    for (auto _ : state)
+    {
+        std::lock_guard<std::mutex> lock(g_mutex);
+        g_vw->push_back(v++);
+    }
+    if (state.thread_index() == 0)
+    {
+        delete g_vw;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_ConcurrentVector_PushBack)->ThreadRange(1, 64)->Threads(48)->UseRealTime();
+BENCHMARK(BM_MutexVectorWarpper_PushBack)->ThreadRange(1, 64)->Threads(48)->UseRealTime();
+BENCHMARK(BM_ConcurrentVector_GrowBy)->ThreadRange(1, 64)->Threads(48)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,196 @@
+#include <list>
+#include "bench_common.cpp"
+#include "../src/stl_list.cpp"
+
+/**
+ * @brief listWarpper 与 std::list 的对比：头尾插入、头尾删除、中间插入、遍历
+ */
+
+/**
+ * @brief 构造并析构一个空容器
+ */
+template <typename T>
+static void BM_ListWarpper_Construct(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        listWarpper<T> lw;
+        benchmark::DoNotOptimize(&lw);
+        benchmark::ClobberMemory();
+    }
+}
+
+template <typename T>
+static void BM_StdList_Construct(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        std::list<T> l;
+        benchmark::DoNotOptimize(&l);
+        benchmark::ClobberMemory();
+    }
+}
+
+template <typename T>
+static void BM_ListWarpper_PushBack(benchmark::State &state)
+{
+    const auto values = makeValues<T>(state.range(0));
+    for (auto _ : state)
+    {
+        listWarpper<T> lw;
+        for (const T &v : values)
+        {
+            lw.push_back(v);
+        }
+        benchmark::DoNotOptimize(*lw.begin());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+static void BM_StdList_PushBack(benchmark::State &state)
+{
+    const auto values = makeValues<T>(state.range(0));
+    for (auto _ : state)
+    {
+        std::list<T> l;
+        for (const T &v : values)
+        {
+            l.push_back(v);
+        }
+        benchmark::DoNotOptimize(*l.begin());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+static void BM_ListWarpper_PushPopFront(benchmark::State &state)
+{
+    const auto values = makeValues<T>(state.range(0));
+    listWarpper<T> lw;
+    for (auto _ : state)
+    {
+        for (const T &v : values)
+        {
+            lw.push_front(v);
+        }
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            lw.pop_front();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+
+template <typename T>
+static void BM_StdList_PushPopFront(benchmark::State &state)
+{
+    const auto values = makeValues<T>(state.range(0));
+    std::list<T> l;
+    for (auto _ : state)
+    {
+        for (const T &v : values)
+        {
+            l.push_front(v);
+        }
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            l.pop_front();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+
+template <typename T>
+static void BM_ListWarpper_InsertMiddle(benchmark::State &state)
+{
+    const auto values = makeValues<T>(state.range(0));
+    for (auto _ : state)
+    {
+        listWarpper<T> lw;
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            lw.insert(i / 2, values[i]);
+        }
+        benchmark::DoNotOptimize(*lw.begin());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+static void BM_StdList_InsertMiddle(benchmark::State &state)
+{
+    const auto values = makeValues<T>(state.range(0));
+    for (auto _ : state)
+    {
+        std::list<T> l;
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            auto it = l.begin();
+            std::advance(it, i / 2);
+            l.insert(it, values[i]);
+        }
+        benchmark::DoNotOptimize(*l.begin());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+static void BM_ListWarpper_Iterate(benchmark::State &state)
+{
+    listWarpper<T> lw;
+    for (const T &v : makeValues<T>(state.range(0)))
+    {
+        lw.push_back(v);
+    }
+    for (auto _ : state)
+    {
+        for (auto it = lw.begin(); it != lw.end(); ++it)
+        {
+            benchmark::DoNotOptimize(*it);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+static void BM_StdList_Iterate(benchmark::State &state)
+{
+    std::list<T> l;
+    for (const T &v : makeValues<T>(state.range(0)))
+    {
+        l.push_back(v);
+    }
+    for (auto _ : state)
+    {
+        for (auto &v : l)
+        {
+            benchmark::DoNotOptimize(v);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_ListWarpper_PushBack, int)->Apply(sizeArgs);
+BENCHMARK_TEMPLATE(BM_StdList_PushBack, int)->Apply(sizeArgs);
+BENCHMARK_TEMPLATE(BM_ListWarpper_PushBack, std::string)->Apply(sizeArgs);
+BENCHMARK_TEMPLATE(BM_StdList_PushBack, std::string)->Apply(sizeArgs);
+
+BENCHMARK_TEMPLATE(BM_ListWarpper_PushPopFront, int)->Apply(sizeArgs);
+BENCHMARK_TEMPLATE(BM_StdList_PushPopFront, int)->Apply(sizeArgs);
+BENCHMARK_TEMPLATE(BM_ListWarpper_PushPopFront, std::string)->Apply(sizeArgs);
+BENCHMARK_TEMPLATE(BM_StdList_PushPopFront, std::string)->Apply(sizeArgs);
+
+// 按下标插入需要线性查找位置，只测到 4K
+BENCHMARK_TEMPLATE(BM_ListWarpper_InsertMiddle, int)->RangeMultiplier(8)->Range(8, 1 << 12);
+BENCHMARK_TEMPLATE(BM_StdList_InsertMiddle, int)->RangeMultiplier(8)->Range(8, 1 << 12);
+
+BENCHMARK_TEMPLATE(BM_ListWarpper_Iterate, int)->Apply(sizeArgs);
+BENCHMARK_TEMPLATE(BM_StdList_Iterate, int)->Apply(sizeArgs);
+BENCHMARK_TEMPLATE(BM_ListWarpper_Iterate, std::string)->Apply(sizeArgs);
+BENCHMARK_TEMPLATE(BM_StdList_Iterate, std::string)->Apply(sizeArgs);
+
+BENCHMARK_TEMPLATE(BM_ListWarpper_Construct, int);
+BENCHMARK_TEMPLATE(BM_StdList_Construct, int);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,119 @@
+#include <unordered_map>
+#include "bench_common.cpp"
+#include "../src/stl_map.cpp"
+
+/**
+ * @brief unorderedMapWarpper 与 std::unordered_map 的对比：插入、命中查找
+ * \n unorderedMapWarpper 没有提供迭代器，因此不测遍历
+ */
+
+/**
+ * @brief 构造并析构一个空容器
+ */
+template <typename K>
+static void BM_UnorderedMapWarpper_Construct(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        unorderedMapWarpper<K, int> mw;
+        benchmark::DoNotOptimize(&mw);
+        benchmark::ClobberMemory();
+    }
+}
+
+template <typename K>
+static void BM_StdUnorderedMap_Construct(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        std::unordered_map<K, int> m;
+        benchmark::DoNotOptimize(&m);
+        benchmark::ClobberMemory();
+    }
+}
+
+template <typename K>
+static void BM_UnorderedMapWarpper_Insert(benchmark::State &state)
+{
+    const auto keys = makeValues<K>(state.range(0));
+    for (auto _ : state)
+    {
+        unorderedMapWarpper<K, int> mw;
+        for (size_t i = 0; i < keys.size(); ++i)
+        {
+            mw[keys[i]] = static_cast<int>(i);
+        }
+        benchmark::DoNotOptimize(mw[keys[0]]);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename K>
+static void BM_StdUnorderedMap_Insert(benchmark::State &state)
+{
+    const auto keys = makeValues<K>(state.range(0));
+    for (auto _ : state)
+    {
+        std::unordered_map<K, int> m;
+        for (size_t i = 0; i < keys.size(); ++i)
+        {
+            m[keys[i]] = static_cast<int>(i);
+        }
+        benchmark::DoNotOptimize(m[keys[0]]);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename K>
+static void BM_UnorderedMapWarpper_Lookup(benchmark::State &state)
+{
+    const auto keys = makeValues<K>(state.range(0));
+    unorderedMapWarpper<K, int> mw;
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        mw[keys[i]] = static_cast<int>(i);
+    }
+    const auto &cmw = mw;
+    for (auto _ : state)
+    {
+        for (const K &k : keys)
+        {
+            benchmark::DoNotOptimize(cmw[k]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename K>
+static void BM_StdUnorderedMap_Lookup(benchmark::State &state)
+{
+    const auto keys = makeValues<K>(state.range(0));
+    std::unordered_map<K, int> m;
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        m[keys[i]] = static_cast<int>(i);
+    }
+    for (auto _ : state)
+    {
+        for (const K &k : keys)
+        {
+            benchmark::DoNotOptimize(m.at(k));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_UnorderedMapWarpper_Insert, int)->Apply(sizeArgs);
+BENCHMARK_TEMPLATE(BM_StdUnorderedMap_Insert, int)->Apply(sizeArgs);
+BENCHMARK_TEMPLATE(BM_UnorderedMapWarpper_Insert, std::string)->Apply(sizeArgs);
+BENCHMARK_TEMPLATE(BM_StdUnorderedMap_Insert, std::string)->Apply(sizeArgs);
+
+BENCHMARK_TEMPLATE(BM_UnorderedMapWarpper_Lookup, int)->Apply(sizeArgs);
+BENCHMARK_TEMPLATE(BM_StdUnorderedMap_Lookup, int)->Apply(sizeArgs);
+BENCHMARK_TEMPLATE(BM_UnorderedMapWarpper_Lookup, std::string)->Apply(sizeArgs);
+BENCHMARK_TEMPLATE(BM_StdUnorderedMap_Lookup, std::string)->Apply(sizeArgs);
+
+BENCHMARK_TEMPLATE(BM_UnorderedMapWarpper_Construct, int);
+BENCHMARK_TEMPLATE(BM_StdUnorderedMap_Construct, int);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,181 @@
+#include <random>
+#include "bench_common.cpp"
+#include "../src/stl_vector.cpp"
+#include "../src/stl_packed_vector.cpp"
+
+/**
+ * @brief packedVector 与 vectorWarpper<uint64_t> 的对比：压缩率、顺序扫描和随机访问
+ * \n 参数为数据位宽；Offsets 系列为递增的偏移量，用来对比三种编码
+ */
+namespace
+{
+constexpr size_t kValues = 1 << 20;
+
+using encoding = packedVector<uint64_t>::encoding;
+
+vector<uint64_t> randomValues(unsigned bits)
+{
+    std::mt19937_64 rng(bits);
+    vector<uint64_t> values(kValues);
+    for (auto &v : values)
+    {
+        v = rng() & ((1ULL << bits) - 1);
+    }
+    return values;
+}
+
+vector<uint64_t> sortedOffsets()
+{
+    std::mt19937_64 rng(1);
+    vector<uint64_t> values(kValues);
+    uint64_t offset = 1ULL << 32;
+    for (auto &v : values)
+    {
+        offset += rng() % 4096;
+        v = offset;
+    }
+    return values;
+}
+
+void setCompressionCounters(benchmark::State &state, size_t bytes)
+{
+    state.counters["bytes_per_value"] = static_cast<double>(bytes) / kValues;
+    state.counters["compression_ratio"] = static_cast<double>(kValues * sizeof(uint64_t)) / bytes;
+    state.SetItemsProcessed(state.iterations() * kValues);
+    state.SetBytesProcessed(state.iterations() * bytes);
+}
+
+void scanVector(benchmark::State &state, const vector<uint64_t> &values)
+{
+    vectorWarpper<uint64_t> vw;
+    vw.reserve(values.size());
+    for (uint64_t v : values)
+    {
+        vw.push_back(uint64_t(v));
+    }
+    for (auto _ : state)
+    {
+        uint64_t sum = 0;
+        for (uint64_t v : vw)
+        {
+            sum += v;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    setCompressionCounters(state, vw.size() * sizeof(uint64_t));
+}
+
+void scanPacked(benchmark::State &state, const vector<uint64_t> &values, encoding enc)
+{
+    packedVector<uint64_t> pv(values.begin(), values.end(), enc);
+    std::array<uint64_t, 1024> buf;
+    for (auto _ : state)
+    {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < pv.size(); i += buf.size())
+        {
+            size_t n = pv.decode(i, buf.size(), buf.data());
+            for (size_t j = 0; j < n; ++j)
+            {
+                sum += buf[j];
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    setCompressionCounters(state, pv.bytes());
+}
+} // namespace
+
+static void BM_VectorWarpper_Scan(benchmark::State &state)
+{
+    scanVector(state, randomValues(state.range(0)));
+}
+
+static void BM_PackedVector_Scan(benchmark::State &state)
+{
+    scanPacked(state, randomValues(state.range(0)), encoding::fixed);
+}
+
+static void BM_PackedVector_ScanIterator(benchmark::State &state)
+{
+    const auto values = randomValues(state.range(0));
+    packedVector<uint64_t> pv(values.begin(), values.end());
+    for (auto _ : state)
+    {
+        uint64_t sum = 0;
+        for (uint64_t v : pv)
+        {
+            sum += v;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    setCompressionCounters(state, pv.bytes());
+}
+
+static void BM_VectorWarpper_RandomAccess(benchmark::State &state)
+{
+    const auto values = randomValues(state.range(0));
+    vectorWarpper<uint64_t> vw;
+    for (uint64_t v : values)
+    {
+        vw.push_back(uint64_t(v));
+    }
+    for (auto _ : state)
+    {
+        uint64_t sum = 0;
+        for (size_t i = 0, j = 0; i < kValues; ++i, j = (j + 7919) % kValues)
+        {
+            sum += vw[j];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    setCompressionCounters(state, vw.size() * sizeof(uint64_t));
+}
+
+static void BM_PackedVector_RandomAccess(benchmark::State &state)
+{
+    const auto values = randomValues(state.range(0));
+    packedVector<uint64_t> pv(values.begin(), values.end());
+    for (auto _ : state)
+    {
+        uint64_t sum = 0;
+        for (size_t i = 0, j = 0; i < kValues; ++i, j = (j + 7919) % kValues)
+        {
+            sum += pv[j];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    setCompressionCounters(state, pv.bytes());
+}
+
+static void BM_VectorWarpper_ScanOffsets(benchmark::State &state)
+{
+    scanVector(state, sortedOffsets());
+}
+
+static void BM_PackedVector_ScanOffsets_Fixed(benchmark::State &state)
+{
+    scanPacked(state, sortedOffsets(), encoding::fixed);
+}
+
+static void BM_PackedVector_ScanOffsets_FrameOfReference(benchmark::State &state)
+{
+    scanPacked(state, sortedOffsets(), encoding::frameOfReference);
+}
+
+static void BM_PackedVector_ScanOffsets_Delta(benchmark::State &state)
+{
+    scanPacked(state, sortedOffsets(), encoding::delta);
+}
+
+BENCHMARK(BM_VectorWarpper_Scan)->Arg(20)->Arg(28);
+BENCHMARK(BM_PackedVector_Scan)->Arg(20)->Arg(28);
+BENCHMARK(BM_PackedVector_ScanIterator)->Arg(20)->Arg(28);
+BENCHMARK(BM_VectorWarpper_RandomAccess)->Arg(20)->Arg(28);
+BENCHMARK(BM_PackedVector_RandomAccess)->Arg(20)->Arg(28);
+BENCHMARK(BM_VectorWarpper_ScanOffsets);
+BENCHMARK(BM_PackedVector_ScanOffsets_Fixed);
+BENCHMARK(BM_PackedVector_ScanOffsets_FrameOfReference);
+BENCHMARK(BM_PackedVector_ScanOffsets_Delta);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,123 @@
+#include <functional>
+#include <queue>
+#include "bench_common.cpp"
+#include "../src/stl_priority.cpp"
+
+/**
+ * @brief priorityQueueWarpper 与 std::priority_queue 的对比：插入全部元素后逐个弹出
+ * \n 另外在单调键（事件回放）场景下对比 radixHeap 底层容器和 std::priority_queue 小顶堆
+ */
+
+/**
+ * @brief 构造并析构一个空容器
+ */
+template <typename T>
+static void BM_PriorityQueueWarpper_Construct(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        priorityQueueWarpper<T> pq;
+        benchmark::DoNotOptimize(&pq);
+        benchmark::ClobberMemory();
+    }
+}
+
+template <typename T>
+static void BM_StdPriorityQueue_Construct(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        std::priority_queue<T> pq;
+        benchmark::DoNotOptimize(&pq);
+        benchmark::ClobberMemory();
+    }
+}
+
+template <typename T>
+static void BM_PriorityQueueWarpper_PushPop(benchmark::State &state)
+{
+    const auto values = makeValues<T>(state.range(0));
+    for (auto _ : state)
+    {
+        priorityQueueWarpper<T> pq;
+        for (const T &v : values)
+        {
+            pq.insert(v);
+        }
+        while (!pq.empty())
+        {
+            benchmark::DoNotOptimize(pq.top());
+            pq.removeTop();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+static void BM_StdPriorityQueue_PushPop(benchmark::State &state)
+{
+    const auto values = makeValues<T>(state.range(0));
+    for (auto _ : state)
+    {
+        std::priority_queue<T> pq;
+        for (const T &v : values)
+        {
+            pq.push(v);
+        }
+        while (!pq.empty())
+        {
+            benchmark::DoNotOptimize(pq.top());
+            pq.pop();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/**
+ * @brief 事件回放：队列中保持 n 个事件，每次弹出最早的事件并插入一个稍晚的新事件
+ */
+template <typename Queue>
+static void monotoneReplay(benchmark::State &state)
+{
+    const size_t n = state.range(0);
+    const auto deltas = makeValues<uint64_t>(n);
+    for (auto _ : state)
+    {
+        Queue pq;
+        for (size_t i = 0; i < n; ++i)
+        {
+            pq.insert(deltas[i] % 1000000);
+        }
+        for (size_t i = 0; i < n * 4; ++i)
+        {
+            uint64_t now = pq.top();
+            pq.removeTop();
+            pq.insert(now + deltas[i % n] % 1000000);
+        }
+        benchmark::DoNotOptimize(pq.top());
+    }
+    state.SetItemsProcessed(state.iterations() * n * 5);
+}
+
+static void BM_RadixPriorityQueue_MonotoneReplay(benchmark::State &state)
+{
+    monotoneReplay<radixPriorityQueueWarpper<uint64_t>>(state);
+}
+
+static void BM_MinPriorityQueue_MonotoneReplay(benchmark::State &state)
+{
+    monotoneReplay<priorityQueueWarpper<uint64_t, std::priority_queue<uint64_t, std::vector<uint64_t>, std::greater<uint64_t>>>>(state);
+}
+
+BENCHMARK_TEMPLATE(BM_PriorityQueueWarpper_PushPop, int)->Apply(sizeArgs);
+BENCHMARK_TEMPLATE(BM_StdPriorityQueue_PushPop, int)->Apply(sizeArgs);
+BENCHMARK_TEMPLATE(BM_PriorityQueueWarpper_PushPop, std::string)->Apply(sizeArgs);
+BENCHMARK_TEMPLATE(BM_StdPriorityQueue_PushPop, std::string)->Apply(sizeArgs);
+
+BENCHMARK(BM_RadixPriorityQueue_MonotoneReplay)->Apply(sizeArgs);
+BENCHMARK(BM_MinPriorityQueue_MonotoneReplay)->Apply(sizeArgs);
+
+BENCHMARK_TEMPLATE(BM_PriorityQueueWarpper_Construct, int);
+BENCHMARK_TEMPLATE(BM_StdPriorityQueue_Construct, int);
+
+BENCHMARK_MAIN();
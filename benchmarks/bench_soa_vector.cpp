@@ -0,0 +1,58 @@
+#include "bench_common.cpp"
+#include "../src/stl_vector.cpp"
+#include "../src/stl_soa_vector.cpp"
+
+/**
+ * @brief 8 个字段的记录只扫描其中一个字段：soaVector 的列扫描与 vectorWarpper<Struct> 对比
+ */
+namespace
+{
+struct record
+{
+    uint64_t id;
+    uint64_t a, b, c, d, e, f, g;
+};
+} // namespace
+
+static void BM_VectorWarpper_ScanOneField(benchmark::State &state)
+{
+    vectorWarpper<record> vw;
+    for (int64_t i = 0; i < state.range(0); ++i)
+    {
+        vw.push_back(record{makeValue<uint64_t>(i), 0, 0, 0, 0, 0, 0, 0});
+    }
+    for (auto _ : state)
+    {
+        uint64_t sum = 0;
+        for (const record &r : vw)
+        {
+            sum += r.id;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_SoaVector_ScanOneField(benchmark::State &state)
+{
+    soaVector<uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t, uint64_t> soa;
+    for (int64_t i = 0; i < state.range(0); ++i)
+    {
+        soa.push_back(makeValue<uint64_t>(i), 0, 0, 0, 0, 0, 0, 0);
+    }
+    for (auto _ : state)
+    {
+        uint64_t sum = 0;
+        for (uint64_t id : soa.column<0>())
+        {
+            sum += id;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_VectorWarpper_ScanOneField)->Apply(sizeArgs)->Arg(1 << 20);
+BENCHMARK(BM_SoaVector_ScanOneField)->Apply(sizeArgs)->Arg(1 << 20);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,165 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "../src/stl_timer_wheel.cpp"
+
+/**
+ * @brief 连接超时场景：每个 tick 建立若干连接并设置超时，90% 的连接在超时前完成并取消定时器
+ * \n 时间轮直接 cancel；堆不支持取消，只能标记后在出堆时丢弃
+ */
+namespace
+{
+constexpr uint64_t kTimeout = 30000;   ///< 超时时间（ms）
+constexpr uint64_t kTicks = 60000;     ///< 模拟时长（ms）
+constexpr int kCancelPercent = 90;     ///< 取消比例
+
+/**
+ * @brief 预先生成的操作序列，保证两种实现处理完全相同的输入
+ */
+struct workload
+{
+    vector<uint64_t> deadlines;    ///< 第 i 个连接的超时时间
+    vector<uint64_t> cancelAt;     ///< 第 i 个连接完成的时间，UINT64_MAX 表示不取消
+    vector<vector<uint32_t>> opens;   ///< 每个 tick 新建的连接
+    vector<vector<uint32_t>> closes;  ///< 每个 tick 完成的连接
+};
+
+workload makeWorkload(int perTick)
+{
+    workload w;
+    std::mt19937_64 rng(7);
+    w.opens.resize(kTicks + kTimeout + 1);
+    w.closes.resize(kTicks + kTimeout + 1);
+    for (uint64_t now = 0; now < kTicks; ++now)
+    {
+        for (int i = 0; i < perTick; ++i)
+        {
+            uint32_t id = static_cast<uint32_t>(w.deadlines.size());
+            w.deadlines.push_back(now + kTimeout + rng() % 1000);
+            w.opens[now].push_back(id);
+            if (static_cast<int>(rng() % 100) < kCancelPercent)
+            {
+                w.closes[now + 1 + rng() % (kTimeout - 1)].push_back(id);
+            }
+        }
+    }
+    return w;
+}
+
+const workload &getWorkload(int perTick)
+{
+    static std::vector<std::pair<int, workload>> cache;
+    for (auto &c : cache)
+    {
+        if (c.first == perTick)
+        {
+            return c.second;
+        }
+    }
+    cache.emplace_back(perTick, makeWorkload(perTick));
+    return cache.back().second;
+}
+} // namespace
+
+static void BM_TimerWheel_ConnectionTimeout(benchmark::State &state)
+{
+    const workload &w = getWorkload(static_cast<int>(state.range(0)));
+    size_t fired = 0;
+    for (auto _ : state)
+    {
+        timerWheel<uint32_t> tw;
+        vector<timerWheel<uint32_t>::timerId> ids(w.deadlines.size());
+        for (uint64_t now = 0; now < w.opens.size(); ++now)
+        {
+            for (uint32_t id : w.opens[now])
+            {
+                ids[id] = tw.schedule(w.deadlines[id], id);
+            }
+            for (uint32_t id : w.closes[now])
+            {
+                tw.cancel(ids[id]);
+            }
+            fired += tw.advance(now);
+        }
+        benchmark::DoNotOptimize(fired);
+    }
+    state.SetItemsProcessed(state.iterations() * w.deadlines.size());
+}
+BENCHMARK(BM_TimerWheel_ConnectionTimeout)->Arg(16)->Arg(64)->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief 堆中的条目，取反比较使 priorityQueueWarpper 成为最小堆
+ */
+struct heapEntry
+{
+    uint64_t deadline;
+    uint32_t id;
+    bool operator<(const heapEntry &other) const
+    {
+        return deadline > other.deadline;
+    }
+};
+
+static void BM_PriorityQueue_ConnectionTimeout(benchmark::State &state)
+{
+    const workload &w = getWorkload(static_cast<int>(state.range(0)));
+    size_t fired = 0;
+    for (auto _ : state)
+    {
+        priorityQueueWarpper<heapEntry> pq;
+        vector<bool> cancelled(w.deadlines.size(), false);
+        for (uint64_t now = 0; now < w.opens.size(); ++now)
+        {
+            for (uint32_t id : w.opens[now])
+            {
+                pq.insert(heapEntry{w.deadlines[id], id});
+            }
+            for (uint32_t id : w.closes[now])
+            {
+                cancelled[id] = true;
+            }
+            while (!pq.empty() && pq.top().deadline <= now)
+            {
+                fired += !cancelled[pq.top().id];
+                pq.removeTop();
+            }
+        }
+        benchmark::DoNotOptimize(fired);
+    }
+    state.SetItemsProcessed(state.iterations() * w.deadlines.size());
+}
+BENCHMARK(BM_PriorityQueue_ConnectionTimeout)->Arg(16)->Arg(64)->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief 稀疏场景：少量定时器分布在很长的时间范围内，每次推进跨越大量空 tick
+ * \n 推进的代价只取决于到期和级联的槽位数，与经过的 tick 数无关
+ */
+static void BM_TimerWheel_SparseAdvance(benchmark::State &state)
+{
+    const size_t timers = static_cast<size_t>(state.range(0));
+    std::mt19937_64 rng(11);
+    vector<uint64_t> deadlines(timers);
+    for (uint64_t &d : deadlines)
+    {
+        d = 1 + rng() % (1ULL << 32);
+    }
+    size_t fired = 0;
+    for (auto _ : state)
+    {
+        timerWheel<uint32_t> tw;
+        for (size_t i = 0; i < timers; ++i)
+        {
+            tw.schedule(deadlines[i], static_cast<uint32_t>(i));
+        }
+        for (uint64_t now = 0; now <= (1ULL << 32); now += 1ULL << 24)
+        {
+            fired += tw.advance(now);
+        }
+        benchmark::DoNotOptimize(fired);
+    }
+    state.SetItemsProcessed(state.iterations() * timers);
+}
+BENCHMARK(BM_TimerWheel_SparseAdvance)->Arg(16)->Arg(1024)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
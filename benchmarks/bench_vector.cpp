@@ -0,0 +1,230 @@
+#include <vector>
+#include "bench_common.cpp"
+#include "../src/stl_vector.cpp"
+
+/**
+ * @brief vectorWarpper 与 std::vector 的对比：尾插、中间插入、随机访问、遍历
+ */
+
+/**
+ * @brief 构造并析构一个空容器
+ */
+template <typename T>
+static void BM_VectorWarpper_Construct(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        vectorWarpper<T> vw;
+        benchmark::DoNotOptimize(&vw);
+        benchmark::ClobberMemory();
+    }
+}
+
+template <typename T>
+static void BM_StdVector_Construct(benchmark::State &state)
+{
+    for (auto _ : state)
+    {
+        std::vector<T> vec;
+        benchmark::DoNotOptimize(&vec);
+        benchmark::ClobberMemory();
+    }
+}
+
+/**
+ * @brief 构造 n 个各含一个元素的容器并放入 std::vector，依赖移动构造
+ */
+template <typename T>
+static void BM_VectorWarpper_Nested(benchmark::State &state)
+{
+    const auto values = makeValues<T>(state.range(0));
+    for (auto _ : state)
+    {
+        std::vector<vectorWarpper<T>> outer;
+        for (const T &v : values)
+        {
+            vectorWarpper<T> inner;
+            inner.push_back(T(v));
+            outer.push_back(std::move(inner));
+        }
+        benchmark::DoNotOptimize(outer.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+static void BM_StdVector_Nested(benchmark::State &state)
+{
+    const auto values = makeValues<T>(state.range(0));
+    for (auto _ : state)
+    {
+        std::vector<std::vector<T>> outer;
+        for (const T &v : values)
+        {
+            std::vector<T> inner;
+            inner.push_back(T(v));
+            outer.push_back(std::move(inner));
+        }
+        benchmark::DoNotOptimize(outer.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+static void BM_VectorWarpper_PushBack(benchmark::State &state)
+{
+    const auto values = makeValues<T>(state.range(0));
+    for (auto _ : state)
+    {
+        vectorWarpper<T> vw;
+        for (const T &v : values)
+        {
+            vw.push_back(T(v));
+        }
+        benchmark::DoNotOptimize(vw[0]);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+static void BM_StdVector_PushBack(benchmark::State &state)
+{
+    const auto values = makeValues<T>(state.range(0));
+    for (auto _ : state)
+    {
+        std::vector<T> vec;
+        for (const T &v : values)
+        {
+            vec.push_back(T(v));
+        }
+        benchmark::DoNotOptimize(vec[0]);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+static void BM_VectorWarpper_InsertMiddle(benchmark::State &state)
+{
+    const auto values = makeValues<T>(state.range(0));
+    for (auto _ : state)
+    {
+        vectorWarpper<T> vw;
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            vw.insert(i / 2, T(values[i]));
+        }
+        benchmark::DoNotOptimize(vw[0]);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+static void BM_StdVector_InsertMiddle(benchmark::State &state)
+{
+    const auto values = makeValues<T>(state.range(0));
+    for (auto _ : state)
+    {
+        std::vector<T> vec;
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            vec.insert(vec.begin() + i / 2, T(values[i]));
+        }
+        benchmark::DoNotOptimize(vec[0]);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+static void BM_VectorWarpper_Lookup(benchmark::State &state)
+{
+    const size_t n = state.range(0);
+    vectorWarpper<T> vw;
+    for (const T &v : makeValues<T>(n))
+    {
+        vw.push_back(T(v));
+    }
+    for (auto _ : state)
+    {
+        // 步长与 n 互质的跳跃访问，避免顺序访问被预取掩盖
+        for (size_t i = 0, j = 0; i < n; ++i, j = (j + 7919) % n)
+        {
+            benchmark::DoNotOptimize(vw[j]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename T>
+static void BM_StdVector_Lookup(benchmark::State &state)
+{
+    const size_t n = state.range(0);
+    std::vector<T> vec = makeValues<T>(n);
+    for (auto _ : state)
+    {
+        for (size_t i = 0, j = 0; i < n; ++i, j = (j + 7919) % n)
+        {
+            benchmark::DoNotOptimize(vec[j]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename T>
+static void BM_VectorWarpper_Iterate(benchmark::State &state)
+{
+    vectorWarpper<T> vw;
+    for (const T &v : makeValues<T>(state.range(0)))
+    {
+        vw.push_back(T(v));
+    }
+    for (auto _ : state)
+    {
+        for (auto &v : vw)
+        {
+            benchmark::DoNotOptimize(v);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+static void BM_StdVector_Iterate(benchmark::State &state)
+{
+    std::vector<T> vec = makeValues<T>(state.range(0));
+    for (auto _ : state)
+    {
+        for (auto &v : vec)
+        {
+            benchmark::DoNotOptimize(v);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_VectorWarpper_PushBack, int)->Apply(sizeArgs);
+BENCHMARK_TEMPLATE(BM_StdVector_PushBack, int)->Apply(sizeArgs);
+BENCHMARK_TEMPLATE(BM_VectorWarpper_PushBack, std::string)->Apply(sizeArgs);
+BENCHMARK_TEMPLATE(BM_StdVector_PushBack, std::string)->Apply(sizeArgs);
+
+// 中间插入是 O(n^2)，只测到 4K
+BENCHMARK_TEMPLATE(BM_VectorWarpper_InsertMiddle, int)->RangeMultiplier(8)->Range(8, 1 << 12);
+BENCHMARK_TEMPLATE(BM_StdVector_InsertMiddle, int)->RangeMultiplier(8)->Range(8, 1 << 12);
+BENCHMARK_TEMPLATE(BM_VectorWarpper_InsertMiddle, std::string)->RangeMultiplier(8)->Range(8, 1 << 12);
+BENCHMARK_TEMPLATE(BM_StdVector_InsertMiddle, std::string)->RangeMultiplier(8)->Range(8, 1 << 12);
+
+BENCHMARK_TEMPLATE(BM_VectorWarpper_Lookup, int)->Apply(sizeArgs);
+BENCHMARK_TEMPLATE(BM_StdVector_Lookup, int)->Apply(sizeArgs);
+BENCHMARK_TEMPLATE(BM_VectorWarpper_Lookup, std::string)->Apply(sizeArgs);
+BENCHMARK_TEMPLATE(BM_StdVector_Lookup, std::string)->Apply(sizeArgs);
+
+BENCHMARK_TEMPLATE(BM_VectorWarpper_Iterate, int)->Apply(sizeArgs);
+BENCHMARK_TEMPLATE(BM_StdVector_Iterate, int)->Apply(sizeArgs);
+BENCHMARK_TEMPLATE(BM_VectorWarpper_Iterate, std::string)->Apply(sizeArgs);
+BENCHMARK_TEMPLATE(BM_StdVector_Iterate, std::string)->Apply(sizeArgs);
+
+BENCHMARK_TEMPLATE(BM_VectorWarpper_Construct, int);
+BENCHMARK_TEMPLATE(BM_StdVector_Construct, int);
+BENCHMARK_TEMPLATE(BM_VectorWarpper_Nested, int)->Apply(sizeArgs);
+BENCHMARK_TEMPLATE(BM_StdVector_Nested, int)->Apply(sizeArgs);
+
+BENCHMARK_MAIN();
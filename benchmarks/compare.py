@@ -0,0 +1,48 @@
+#!/usr/bin/env python3
+"""对比两份 Google Benchmark JSON 输出，列出 cpu_time 变化超过阈值的基准测试。
+
+用法: compare.py <baseline.json> <current.json> [--threshold 0.10]
+有回退（变慢超过阈值）时返回 1。
+"""
+import argparse
+import json
+import sys
+
+
+def load(path):
+    with open(path) as f:
+        data = json.load(f)
+    return {b["name"]: b for b in data["benchmarks"] if b.get("run_type", "iteration") == "iteration"}
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=0.10, help="相对变化阈值，默认 10%%")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    current = load(args.current)
+    regressions = 0
+    for name, cur in current.items():
+        base = baseline.get(name)
+        if base is None:
+            print(f"{'NEW':>8}  {name}")
+            continue
+        change = cur["cpu_time"] / base["cpu_time"] - 1.0
+        if change > args.threshold:
+            regressions += 1
+            tag = "SLOWER"
+        elif change < -args.threshold:
+            tag = "FASTER"
+        else:
+            continue
+        print(f"{tag:>8}  {name}: {base['cpu_time']:.1f} -> {cur['cpu_time']:.1f} {cur['time_unit']} ({change:+.1%})")
+    for name in baseline.keys() - current.keys():
+        print(f"{'MISSING':>8}  {name}")
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
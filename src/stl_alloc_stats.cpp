@@ -0,0 +1,334 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using std::size_t;
+
+/**
+ * @brief 某一时刻的内存统计快照，可以直接交给监控系统上报
+ */
+struct allocSnapshot
+{
+    static constexpr size_t kSizeClasses = 24; ///< 第 i 类为 (2^(i-1), 2^i] 字节，最后一类包含所有更大的申请
+
+    std::string name;          ///< 统计对象的名字（实例名或标签）
+    uint64_t allocations = 0;  ///< 累计申请次数
+    uint64_t deallocations = 0; ///< 累计释放次数
+    uint64_t bytesTotal = 0;   ///< 累计申请字节数
+    uint64_t bytesLive = 0;    ///< 当前未释放的字节数
+    uint64_t bytesPeak = 0;    ///< bytesLive 的历史最大值
+    std::array<uint64_t, kSizeClasses> sizeClasses{}; ///< 按申请大小划分的次数直方图
+
+    /**
+     * @brief 序列化为一个 JSON 对象
+     * @return JSON 字符串
+     */
+    std::string toJson() const
+    {
+        std::string json = "{\"name\":" + escapeJson(name);
+        json += ",\"allocations\":" + std::to_string(allocations);
+        json += ",\"deallocations\":" + std::to_string(deallocations);
+        json += ",\"bytes_total\":" + std::to_string(bytesTotal);
+        json += ",\"bytes_live\":" + std::to_string(bytesLive);
+        json += ",\"bytes_peak\":" + std::to_string(bytesPeak);
+        json += ",\"size_classes\":[";
+        for (size_t i = 0; i < kSizeClasses; ++i)
+        {
+            json += (i ? "," : "") + std::to_string(sizeClasses[i]);
+        }
+        return json + "]}";
+    }
+
+    /**
+     * @brief 把字符串转义为 JSON 字符串字面量（含两侧引号）
+     * \n 转义引号、反斜杠和所有控制字符，其余字节（包括 UTF-8 多字节序列）原样输出
+     * @param s 原始字符串
+     * @return JSON 字符串字面量
+     */
+    static std::string escapeJson(const std::string &s)
+    {
+        static constexpr char kHex[] = "0123456789abcdef";
+        std::string out = "\"";
+        out.reserve(s.size() + 2);
+        for (char c : s)
+        {
+            switch (c)
+            {
+            case '"':
+                out += "\\\"";
+                break;
+            case '\\':
+                out += "\\\\";
+                break;
+            case '\b':
+                out += "\\b";
+                break;
+            case '\f':
+                out += "\\f";
+                break;
+            case '\n':
+                out += "\\n";
+                break;
+            case '\r':
+                out += "\\r";
+                break;
+            case '\t':
+                out += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    out += "\\u00";
+                    out += kHex[static_cast<unsigned char>(c) >> 4];
+                    out += kHex[static_cast<unsigned char>(c) & 0xf];
+                }
+                else
+                {
+                    out += c;
+                }
+            }
+        }
+        return out + "\"";
+    }
+};
+
+/**
+ * @brief 一组内存申请的统计计数器
+ * \n 计数器都是原子变量，可以被多个线程中的容器同时更新
+ * \n 可以指定父节点：每次申请和释放都会沿父节点链向上累加，用于把单个容器实例的统计汇总到所属标签
+ * \n 对象本身不拥有父节点，父节点和所有使用它的容器都必须在它之前创建、之后销毁
+ */
+class allocStats
+{
+public:
+    /**
+     * @brief 构造函数
+     * @param name 统计对象的名字
+     * @param parent 父节点，可以为空
+     */
+    explicit allocStats(std::string name = "", allocStats *parent = nullptr)
+        : _name(std::move(name)), _parent(parent) {}
+
+    allocStats(const allocStats &) = delete;
+    allocStats &operator=(const allocStats &) = delete;
+
+    /**
+     * @brief 记录一次申请
+     * @param bytes 申请的字节数
+     */
+    void recordAllocate(size_t bytes)
+    {
+        for (allocStats *s = this; s; s = s->_parent)
+        {
+            s->_allocations.fetch_add(1, std::memory_order_relaxed);
+            s->_bytesTotal.fetch_add(bytes, std::memory_order_relaxed);
+            s->_sizeClasses[sizeClass(bytes)].fetch_add(1, std::memory_order_relaxed);
+            uint64_t live = s->_bytesLive.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+            uint64_t peak = s->_bytesPeak.load(std::memory_order_relaxed);
+            while (live > peak && !s->_bytesPeak.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+            {
+            }
+        }
+    }
+
+    /**
+     * @brief 记录一次释放
+     * @param bytes 释放的字节数
+     */
+    void recordDeallocate(size_t bytes)
+    {
+        for (allocStats *s = this; s; s = s->_parent)
+        {
+            s->_deallocations.fetch_add(1, std::memory_order_relaxed);
+            s->_bytesLive.fetch_sub(bytes, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief 获取当前统计的快照
+     * 各个计数器分别读取，并发更新时快照内部不保证严格一致
+     * @return 快照
+     */
+    allocSnapshot snapshot() const
+    {
+        allocSnapshot snap;
+        snap.name = _name;
+        snap.allocations = _allocations.load(std::memory_order_relaxed);
+        snap.deallocations = _deallocations.load(std::memory_order_relaxed);
+        snap.bytesTotal = _bytesTotal.load(std::memory_order_relaxed);
+        snap.bytesLive = _bytesLive.load(std::memory_order_relaxed);
+        snap.bytesPeak = _bytesPeak.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < allocSnapshot::kSizeClasses; ++i)
+        {
+            snap.sizeClasses[i] = _sizeClasses[i].load(std::memory_order_relaxed);
+        }
+        return snap;
+    }
+
+    /**
+     * @brief 获取名字
+     * @return 名字
+     */
+    const std::string &name() const
+    {
+        return _name;
+    }
+
+    /**
+     * @brief 计算申请大小所属的类别
+     * @param bytes 申请的字节数
+     * @return 类别下标
+     */
+    static size_t sizeClass(size_t bytes)
+    {
+        size_t cls = bytes <= 1 ? 0 : static_cast<size_t>(std::bit_width(bytes - 1));
+        return cls < allocSnapshot::kSizeClasses ? cls : allocSnapshot::kSizeClasses - 1;
+    }
+
+private:
+    std::string _name;
+    allocStats *_parent;
+    std::atomic<uint64_t> _allocations{0};
+    std::atomic<uint64_t> _deallocations{0};
+    std::atomic<uint64_t> _bytesTotal{0};
+    std::atomic<uint64_t> _bytesLive{0};
+    std::atomic<uint64_t> _bytesPeak{0};
+    std::array<std::atomic<uint64_t>, allocSnapshot::kSizeClasses> _sizeClasses{};
+};
+
+/**
+ * @brief 按标签管理 allocStats 的全局注册表
+ * \n 标签对应的 allocStats 创建后不会销毁，地址在程序运行期间保持不变
+ */
+class allocRegistry
+{
+public:
+    /**
+     * @brief 获取全局注册表
+     * @return 注册表
+     */
+    static allocRegistry &instance()
+    {
+        static allocRegistry registry;
+        return registry;
+    }
+
+    /**
+     * @brief 获取某个标签的统计对象，不存在时创建
+     * @param tag 标签
+     * @return 统计对象
+     */
+    allocStats &tag(const std::string &tag)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto &stats = _tags[tag];
+        if (!stats)
+        {
+            stats = std::make_unique<allocStats>(tag);
+            _order.push_back(stats.get());
+        }
+        return *stats;
+    }
+
+    /**
+     * @brief 获取所有标签的快照，按标签创建顺序排列
+     * @return 快照列表
+     */
+    std::vector<allocSnapshot> snapshot()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::vector<allocSnapshot> snaps;
+        snaps.reserve(_order.size());
+        for (const allocStats *stats : _order)
+        {
+            snaps.push_back(stats->snapshot());
+        }
+        return snaps;
+    }
+
+    /**
+     * @brief 把所有标签的快照序列化为 JSON 数组
+     * @return JSON 字符串
+     */
+    std::string toJson()
+    {
+        std::string json = "[";
+        bool first = true;
+        for (const allocSnapshot &snap : snapshot())
+        {
+            json += (first ? "" : ",") + snap.toJson();
+            first = false;
+        }
+        return json + "]";
+    }
+
+private:
+    allocRegistry() = default;
+
+    std::mutex _mutex;
+    std::unordered_map<std::string, std::unique_ptr<allocStats>> _tags;
+    std::vector<const allocStats *> _order;
+};
+
+/**
+ * @brief 带统计的分配器，可以作为各个封装类的 Alloc 模板参数
+ * \n 内存仍然由 std::allocator 申请，每次申请和释放都记录到构造时指定的 allocStats 中
+ * \n 容器内部 rebind 出的节点分配器（list 节点、哈希表桶和节点）共享同一个 allocStats，因此所有堆内存都能被统计到
+ * \n 移动赋值时分配器随内存一起转移（propagate_on_container_move_assignment），封装类的移动操作仍然不会抛出异常
+ * @tparam T 元素类型
+ */
+template <typename T>
+class trackingAllocator
+{
+public:
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    /**
+     * @brief 构造函数
+     * @param stats 统计对象，不能为空
+     */
+    explicit trackingAllocator(allocStats *stats) noexcept : _stats(stats) {}
+
+    template <typename U>
+    trackingAllocator(const trackingAllocator<U> &other) noexcept : _stats(other.stats()) {}
+
+    T *allocate(size_t n)
+    {
+        T *p = std::allocator<T>().allocate(n);
+        _stats->recordAllocate(n * sizeof(T));
+        return p;
+    }
+
+    void deallocate(T *p, size_t n) noexcept
+    {
+        _stats->recordDeallocate(n * sizeof(T));
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    /**
+     * @brief 获取统计对象
+     * @return 统计对象
+     */
+    allocStats *stats() const noexcept
+    {
+        return _stats;
+    }
+
+    template <typename U>
+    bool operator==(const trackingAllocator<U> &other) const noexcept
+    {
+        return _stats == other.stats();
+    }
+
+private:
+    allocStats *_stats;
+};
@@ -0,0 +1,425 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+using std::size_t;
+
+/**
+ * @brief 支持多线程并发追加的数组，接口与 vectorWarpper 的 push_back/emplace_back/operator[]/size/reserve 保持一致。
+ * \n 元素保存在按几何级数增长的段（segment）中：第 k 段容纳 kFirstSegment * 2^k 个元素，段一旦分配就不会移动，因此已有元素的地址永远有效
+ * \n 追加时用原子计数器 fetch_add 领取下标，不需要加锁；下标所在的段还没有分配时，各线程用 CAS 竞争安装新段，失败的一方释放自己的段
+ * \n 下标换算为 (段号, 段内偏移) 只需要一次 bit_width，operator[] 不加锁
+ * \n 可见性约定与 tbb::concurrent_vector 相同：size() 统计的是已领取的下标，其中可能有元素正在构造。
+ * \n 读取其他线程追加的元素前，需要与该线程同步（例如 join，或通过 release/acquire 原子变量传递下标）
+ * \n 追加前先检查容量上限，超出时抛出 std::length_error，此时不会领取下标
+ * \n 元素构造失败可以恢复：T 的移动构造不抛出异常时，emplace_back 先在领取下标之前构造临时对象，构造抛出的异常原样传出且不领取下标，
+ * 领取之后再移动到位；grow_by 中某个拷贝抛出异常时，剩余的已领取位置用 T() 填充后重新抛出异常
+ * \n 无法回滚的情况调用 std::terminate，否则析构时会销毁从未构造过的位置：
+ * \n - 下标领取之后段分配失败（std::bad_alloc）。需要从内存不足中恢复时，先调用 reserve（失败时正常抛出异常）预先分配段
+ * \n - T 的移动构造可能抛出异常时 emplace_back 的构造失败，以及 T() 可能抛出异常时 grow_by 的拷贝失败
+ * @tparam T 元素类型
+ */
+template <typename T>
+class concurrentVector
+{
+public:
+    static constexpr size_t kFirstSegment = 64; ///< 第 0 段的大小，必须是 2 的幂
+    static constexpr size_t kMaxSegments = 48;  ///< 段的数量上限，容量上限约为 kFirstSegment * 2^48
+    static constexpr size_t kMaxSize = kFirstSegment * ((size_t(1) << kMaxSegments) - 1); ///< 容量上限
+
+    class iterator;
+
+    /**
+     * @brief 无参构造函数，不申请内存
+     */
+    concurrentVector() = default;
+
+    /**
+     * @brief 禁止拷贝构造
+     */
+    concurrentVector(const concurrentVector &) = delete;
+
+    /**
+     * @brief 禁止移动构造，其他线程可能持有元素的引用
+     */
+    concurrentVector(concurrentVector &&) = delete;
+
+    /**
+     * @brief 禁止赋值
+     */
+    concurrentVector &operator=(const concurrentVector &) = delete;
+
+    /**
+     * @brief 禁止移动赋值
+     */
+    concurrentVector &operator=(concurrentVector &&) = delete;
+
+    /**
+     * @brief 析构函数，销毁所有元素并释放所有段，调用时不能有其他线程在访问
+     */
+    ~concurrentVector()
+    {
+        size_t n = _size.load(std::memory_order_relaxed);
+        for (size_t k = 0; k < kMaxSegments; ++k)
+        {
+            T *seg = _segments[k].load(std::memory_order_relaxed);
+            if (!seg)
+            {
+                continue;
+            }
+            size_t first = segmentBase(k);
+            size_t count = n > first ? std::min(n - first, segmentSize(k)) : 0;
+            std::destroy_n(seg, count);
+            ::operator delete(static_cast<void *>(seg), std::align_val_t(alignof(T)));
+        }
+    }
+
+    /**
+     *  @brief 从尾部插入一个对象，可以被多个线程同时调用
+     *  @param t 一个类型为T的元素
+     *  @return 新元素的下标
+     */
+    size_t push_back(const T &t)
+    {
+        return emplace_back(t);
+    }
+
+    /**
+     *  @brief 从尾部插入一个对象，可以被多个线程同时调用
+     *  @param t 一个类型为T的元素
+     *  @return 新元素的下标
+     */
+    size_t push_back(T &&t)
+    {
+        return emplace_back(std::move(t));
+    }
+
+    /**
+     *  @brief 在尾部直接构造一个对象，可以被多个线程同时调用
+     *  @param args 构造参数
+     *  @return 新元素的下标
+     */
+    template <typename... Args>
+    size_t emplace_back(Args &&...args)
+    {
+        checkGrowth(1);
+        if constexpr (std::is_nothrow_constructible_v<T, Args &&...>)
+        {
+            // 构造不会抛出异常（包括 push_back(T&&)），直接在位置上构造
+            size_t index = _size.fetch_add(1, std::memory_order_relaxed);
+            constructAt(index, std::forward<Args>(args)...);
+            return index;
+        }
+        else if constexpr (std::is_nothrow_move_constructible_v<T>)
+        {
+            // 构造可能抛出异常：先构造临时对象，失败时还没有领取下标
+            T value(std::forward<Args>(args)...);
+            size_t index = _size.fetch_add(1, std::memory_order_relaxed);
+            constructAt(index, std::move(value));
+            return index;
+        }
+        else
+        {
+            size_t index = _size.fetch_add(1, std::memory_order_relaxed);
+            constructAt(index, std::forward<Args>(args)...);
+            return index;
+        }
+    }
+
+    /**
+     *  @brief 一次领取 n 个连续下标，并用 t 的拷贝构造这些元素，可以被多个线程同时调用
+     *  批量追加时只需要一次原子操作；某个拷贝抛出异常时，剩余位置用 T() 填充后重新抛出异常
+     *  @param n 追加的数量
+     *  @param t 初始值
+     *  @return 第一个新元素的下标
+     */
+    size_t grow_by(size_t n, const T &t = T())
+    {
+        checkGrowth(n);
+        size_t first = _size.fetch_add(n, std::memory_order_relaxed);
+        constructRange(first, first + n, t);
+        return first;
+    }
+
+    /**
+     *  @brief 预先分配能容纳 capacity 个元素的段，可以被多个线程同时调用
+     *  不影响 size，也不移动任何元素；超出容量上限时抛出 std::length_error，内存不足时抛出 std::bad_alloc
+     *  @param capacity 需要的容量
+     *  @return 成功会返回0
+     */
+    int reserve(size_t capacity)
+    {
+        if (capacity == 0)
+        {
+            return 0;
+        }
+        if (capacity > kMaxSize)
+        {
+            throw std::length_error("concurrentVector is too large");
+        }
+        size_t last = locate(capacity - 1).first;
+        for (size_t k = 0; k <= last; ++k)
+        {
+            segment(k);
+        }
+        return 0;
+    }
+
+    /**
+     *  @brief 获取某个元素的引用，不加锁，不检查越界
+     *  @param index 需要获取元素的索引
+     *  @return 元素的引用
+     */
+    T &operator[](size_t index)
+    {
+        auto [k, offset] = locate(index);
+        return _segments[k].load(std::memory_order_acquire)[offset];
+    }
+
+    /**
+     *  @brief 获取某个元素的常量引用，不加锁，不检查越界
+     *  @param index 需要获取元素的索引
+     *  @return 元素的常量引用
+     */
+    const T &operator[](size_t index) const
+    {
+        auto [k, offset] = locate(index);
+        return _segments[k].load(std::memory_order_acquire)[offset];
+    }
+
+    /**
+     *  @brief 获取某个元素的引用，越界时抛出异常
+     *  @param index 需要获取元素的索引
+     *  @return 元素的引用
+     */
+    T &at(size_t index)
+    {
+        if (index >= size())
+        {
+            throw std::out_of_range("Index out of range");
+        }
+        return (*this)[index];
+    }
+
+    /**
+     *  @brief 获取已领取的下标数量，可能包含正在构造的元素
+     *  @return 元素数量
+     */
+    size_t size() const
+    {
+        return _size.load(std::memory_order_acquire);
+    }
+
+    /**
+     *  @brief 获取已分配的段能容纳的元素数量
+     *  @return 容量
+     */
+    size_t capacity() const
+    {
+        size_t k = 0;
+        while (k < kMaxSegments && _segments[k].load(std::memory_order_acquire))
+        {
+            ++k;
+        }
+        return segmentBase(k);
+    }
+
+    /**
+     * @brief 获取开始位置迭代器
+     * @return 迭代器
+     */
+    iterator begin()
+    {
+        return iterator(this, 0);
+    }
+
+    /**
+     * @brief 获取结束位置迭代器，位置为调用时的 size()
+     * @return 迭代器
+     */
+    iterator end()
+    {
+        return iterator(this, size());
+    }
+
+    /**
+     * @brief 按下标遍历的前向迭代器
+     */
+    class iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T *;
+        using reference = T &;
+
+        iterator() = default;
+
+        reference operator*() const
+        {
+            return (*_cv)[_index];
+        }
+
+        pointer operator->() const
+        {
+            return &(*_cv)[_index];
+        }
+
+        iterator &operator++()
+        {
+            ++_index;
+            return *this;
+        }
+
+        iterator operator++(int)
+        {
+            iterator old = *this;
+            ++_index;
+            return old;
+        }
+
+        bool operator==(const iterator &other) const
+        {
+            return _index == other._index;
+        }
+
+    private:
+        friend class concurrentVector;
+
+        iterator(concurrentVector *cv, size_t index) : _cv(cv), _index(index) {}
+
+        concurrentVector *_cv = nullptr;
+        size_t _index = 0;
+    };
+
+private:
+    static_assert(std::has_single_bit(kFirstSegment), "kFirstSegment must be a power of two");
+
+    static constexpr size_t segmentSize(size_t k)
+    {
+        return kFirstSegment << k;
+    }
+
+    /**
+     * @brief 第 k 段第一个元素的下标
+     */
+    static constexpr size_t segmentBase(size_t k)
+    {
+        return kFirstSegment * ((size_t(1) << k) - 1);
+    }
+
+    /**
+     * @brief 下标换算为 (段号, 段内偏移)
+     */
+    static std::pair<size_t, size_t> locate(size_t index)
+    {
+        size_t k = std::bit_width(index / kFirstSegment + 1) - 1;
+        return {k, index - segmentBase(k)};
+    }
+
+    /**
+     * @brief 获取第 k 段，未分配时分配并用 CAS 安装
+     */
+    T *segment(size_t k)
+    {
+        if (k >= kMaxSegments)
+        {
+            throw std::length_error("concurrentVector is too large");
+        }
+        T *seg = _segments[k].load(std::memory_order_acquire);
+        if (seg)
+        {
+            return seg;
+        }
+        T *fresh = static_cast<T *>(::operator new(segmentSize(k) * sizeof(T), std::align_val_t(alignof(T))));
+        if (_segments[k].compare_exchange_strong(seg, fresh, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            return fresh;
+        }
+        // 其他线程已经安装了这一段
+        ::operator delete(static_cast<void *>(fresh), std::align_val_t(alignof(T)));
+        return seg;
+    }
+
+    /**
+     * @brief 追加 n 个元素前检查容量上限，超出时抛出 std::length_error
+     * 多个线程同时追加时仍可能越过上限，此时在 constructAt/constructRange 中终止程序
+     */
+    void checkGrowth(size_t n) const
+    {
+        if (n > kMaxSize - std::min(size(), kMaxSize))
+        {
+            throw std::length_error("concurrentVector is too large");
+        }
+    }
+
+    /**
+     * @brief 在已领取的下标 index 处构造元素，段分配或构造抛出异常时终止程序
+     */
+    template <typename... Args>
+    void constructAt(size_t index, Args &&...args) noexcept
+    {
+        auto [k, offset] = locate(index);
+        ::new (static_cast<void *>(segment(k) + offset)) T(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief 获取已领取下标所在的段，分配失败时终止程序
+     */
+    T *claimedSegment(size_t k) noexcept
+    {
+        return segment(k);
+    }
+
+    /**
+     * @brief 在已领取的下标 [first, end) 处用 t 的拷贝构造元素
+     * 拷贝抛出异常时，用 T() 构造剩余位置，保证所有已领取的位置都已构造，然后重新抛出异常
+     */
+    void constructRange(size_t first, size_t end, const T &t)
+    {
+        size_t i = first;
+        try
+        {
+            while (i < end)
+            {
+                // 按段逐段构造，段内地址连续
+                auto [k, offset] = locate(i);
+                T *seg = claimedSegment(k);
+                size_t count = std::min(segmentSize(k) - offset, end - i);
+                for (size_t j = 0; j < count; ++j, ++i)
+                {
+                    ::new (static_cast<void *>(seg + offset + j)) T(t);
+                }
+            }
+        }
+        catch (...)
+        {
+            fillDefault(i, end);
+            throw;
+        }
+    }
+
+    /**
+     * @brief 用 T() 构造 [first, end)，T() 抛出异常时终止程序
+     */
+    void fillDefault(size_t first, size_t end) noexcept
+    {
+        for (size_t i = first; i < end; ++i)
+        {
+            constructAt(i);
+        }
+    }
+
+    std::atomic<size_t> _size{0};                          ///< 已领取的下标数量
+    std::array<std::atomic<T *>, kMaxSegments> _segments{}; ///< 各段的起始地址，未分配时为空
+};
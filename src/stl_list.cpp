@@ -1,6 +1,9 @@
+#pragma once
 #include <iostream>
 #include <gtest/gtest.h>
 #include <list>
+#include <memory>
+#include <type_traits>
 using std::list;
 
 /**
@@ -9,56 +12,57 @@ using std::list;
  * \n 节点结构有_List_node、_List_node_header以及_List_iterator和_List_const_iterator
  * \n struct _List_node_base { _List_node_base* _M_next; _List_node_base* _M_prev;}
  * \n _List_node_header继承自_List_node_base， 新增了_M_size用于表示链表的大小
+ * \n std::list 直接作为成员保存，构造封装类本身不申请内存；移动构造和移动赋值只转移头节点，不会抛出异常
+ * \n 分配器在移动赋值时既不传播也不总是相等时，移动赋值可能需要逐个节点移动并申请内存，此时移动赋值不是 noexcept
+ * \n 可以通过 Alloc 指定分配器，例如使用 trackingAllocator 统计节点的内存申请
  */
-template <typename T>
+template <typename T, typename Alloc = std::allocator<T>>
 class listWarpper
 {
 public:
-    listWarpper() : _list(new list<T>()) {}
+    listWarpper() = default;
+    /**
+     * @brief 指定分配器的构造函数
+     * @param alloc 分配器，会被 rebind 为节点分配器
+     */
+    explicit listWarpper(const Alloc &alloc) : _list(alloc) {}
     /**
      * @brief 禁止拷贝构造
      */
     listWarpper(const listWarpper &) = delete;
     /**
-     * @brief 禁止移动拷贝构造
+     * @brief 移动构造，接管 other 的节点，other 变为空
      */
-    listWarpper(listWarpper &&) = delete;
+    listWarpper(listWarpper &&) noexcept(std::is_nothrow_move_constructible_v<list<T, Alloc>>) = default;
     /**
      * @brief 禁止赋值
      */
     listWarpper &operator=(const listWarpper &) = delete;
     /**
-     * @brief 禁止移动赋值
+     * @brief 移动赋值，释放当前节点并接管 other 的节点，other 变为空
      */
-    listWarpper &operator=(listWarpper &&) = delete;
+    listWarpper &operator=(listWarpper &&) noexcept(std::is_nothrow_move_assignable_v<list<T, Alloc>>) = default;
     /**
      * @brief 析构函数
      */
-    ~listWarpper()
-    {
-        delete _list;
-    }
+    ~listWarpper() = default;
 
     /**
-     * @brief 获取迭代器
-     * @return 成功时返回迭代器，失败时抛出异常
+     * @brief 获取开始位置迭代器
+     * @return 迭代器
      */
-    typename list<T>::iterator begin()
+    typename list<T, Alloc>::iterator begin()
     {
-        if (_list)
-            return _list->begin();
-        throw std::runtime_error("List is not initialized");
+        return _list.begin();
     }
 
     /**
-     * @brief 获取迭代器
-     * @return 成功时返回迭代器，失败时抛出异常
+     * @brief 获取结束位置迭代器
+     * @return 迭代器
      */
-    typename list<T>::iterator end()
+    typename list<T, Alloc>::iterator end()
     {
-        if (_list)
-            return _list->end();
-        throw std::runtime_error("List is not initialized");
+        return _list.end();
     }
 
     /**
@@ -69,9 +73,9 @@ public:
      */
     int insert(const size_t index, const T &t)
     {
-        auto it = _list->begin();
+        auto it = _list.begin();
         std::advance(it, index);
-        _list->insert(it, t);
+        _list.insert(it, t);
         return 0;
     }
 
@@ -84,9 +88,9 @@ public:
      */
     int insert(const size_t index, const size_t number, const T &t)
     {
-        auto it = _list->begin();
+        auto it = _list.begin();
         std::advance(it, index);
-        _list->insert(it, number, t);
+        _list.insert(it, number, t);
         return 0;
     }
 
@@ -96,12 +100,12 @@ public:
      * @param other 待插入的list
      * @return 成功时返回0
      */
-    int splice(const size_t index, list<T> &other)
+    int splice(const size_t index, list<T, Alloc> &other)
     {
 
-        auto it = _list->begin();
+        auto it = _list.begin();
         std::advance(it, index);
-        _list->splice(it, other);
+        _list.splice(it, other);
         return 0;
     }
 
@@ -112,7 +116,7 @@ public:
      */
     int push_front(const T &t)
     {
-        _list->push_front(t);
+        _list.push_front(t);
         return 0;
     }
 
@@ -123,7 +127,7 @@ public:
      */
     int push_back(const T &t)
     {
-        _list->push_back(t);
+        _list.push_back(t);
         return 0;
     }
 
@@ -133,7 +137,7 @@ public:
      */
     int pop_front()
     {
-        _list->pop_front();
+        _list.pop_front();
         return 0;
     }
 
@@ -143,10 +147,10 @@ public:
      */
     int pop_back()
     {
-        _list->pop_back();
+        _list.pop_back();
         return 0;
     }
 
 private:
-    list<T> *_list;
+    list<T, Alloc> _list; ///< 被封装的 std::list 对象
 };
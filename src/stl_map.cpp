@@ -1,33 +1,41 @@
+#pragma once
+#include <functional>
 #include <iostream>
+#include <memory>
 #include <unordered_map>
+#include <type_traits>
 
 using std::unordered_map;
 
-template <typename K, typename V>
+/**
+ * @brief 一个自定义的类，封装了 std::unordered_map 的部分功能
+ * \n 可以通过 Alloc 指定分配器，例如使用 trackingAllocator 统计桶数组和节点的内存申请
+ * @tparam K 键类型
+ * @tparam V 值类型
+ * @tparam Alloc 分配器类型
+ */
+template <typename K, typename V, typename Alloc = std::allocator<std::pair<const K, V>>>
 class unorderedMapWarpper
 {
+    using container = unordered_map<K, V, std::hash<K>, std::equal_to<K>, Alloc>;
+
 public:
-    unorderedMapWarpper()
-    {
-        _map = new unordered_map<K, V>();
-    };
+    unorderedMapWarpper() = default;
+    explicit unorderedMapWarpper(const Alloc &alloc) : _map(alloc) {}
     unorderedMapWarpper(const unorderedMapWarpper &) = delete;
-    unorderedMapWarpper(unorderedMapWarpper &&) = delete;
+    unorderedMapWarpper(unorderedMapWarpper &&) noexcept(std::is_nothrow_move_constructible_v<container>) = default;
     unorderedMapWarpper &operator=(const unorderedMapWarpper &) = delete;
-    unorderedMapWarpper &operator=(unorderedMapWarpper &&) = delete;
+    unorderedMapWarpper &operator=(unorderedMapWarpper &&) noexcept(std::is_nothrow_move_assignable_v<container>) = default;
     V &operator[](const K &key)
     {
-        return (*_map)[key];
+        return _map[key];
     }
     const V &operator[](const K &key) const
     {
-        return _map->at(key);
-    }
-    ~unorderedMapWarpper()
-    {
-        delete _map;
+        return _map.at(key);
     }
+    ~unorderedMapWarpper() = default;
 
 private:
-    unordered_map<K, V> *_map;
+    container _map;
 };
@@ -0,0 +1,646 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using std::size_t;
+using std::vector;
+
+/**
+ * @brief 位压缩的无符号整数数组，接口与 vectorWarpper 的 push_back/operator[]/size/迭代保持一致。
+ * \n 所有值按同一个位宽连续存放在 uint64_t 数组中，第 i 个值位于第 i*bits 位。位宽由数据决定：push_back 遇到更宽的值时整体重新打包（位宽只增不减，最多重打包 64 次）
+ * \n 除了固定位宽（fixed），还支持按 128 个值分块的两种编码，每块单独选择位宽：
+ * \n - frameOfReference：块内存放 v - min，适合取值集中但基数较大的数据，随机访问仍为 O(1)
+ * \n - delta：块内存放相邻值之差的 zigzag 编码，适合有序的 ID 和偏移，随机访问需要解码块内前缀，O(128)
+ * \n 分块模式下不满一块的值以原始形式保存在尾部缓冲区中，凑满 128 个后再压缩
+ * \n 每 64 个值恰好占 bits 个 uint64_t，decode 按 64 个一组调用位宽固定的展开解码函数，移位量都是编译期常量，编译器可以向量化
+ * \n operator[] 返回值而不是引用，修改元素请使用 set（仅 fixed 模式）
+ * @tparam Int 无符号整数类型
+ */
+template <typename Int>
+class packedVector
+{
+    static_assert(std::is_unsigned_v<Int>, "packedVector only stores unsigned integers");
+
+public:
+    /**
+     * @brief 编码方式
+     */
+    enum class encoding
+    {
+        fixed,
+        frameOfReference,
+        delta
+    };
+
+    static constexpr size_t kGroup = 64;  ///< 批量解码的最小单位
+    static constexpr size_t kBlock = 128; ///< 分块编码的块大小
+
+    class const_iterator;
+
+    /**
+     * @brief 构造一个空数组
+     * @param enc 编码方式
+     */
+    explicit packedVector(encoding enc = encoding::fixed) : _encoding(enc) {}
+
+    /**
+     * @brief 从一段数据构造，fixed 模式下先扫描一遍数据确定位宽，避免重新打包
+     * @param first 起始迭代器
+     * @param last 结束迭代器
+     * @param enc 编码方式
+     */
+    template <typename It>
+    packedVector(It first, It last, encoding enc = encoding::fixed) : _encoding(enc)
+    {
+        if (_encoding == encoding::fixed)
+        {
+            uint64_t bits = 0;
+            size_t n = 0;
+            for (It it = first; it != last; ++it, ++n)
+            {
+                bits |= static_cast<uint64_t>(*it);
+            }
+            _bits = static_cast<unsigned>(std::bit_width(bits));
+            _words.reserve((n * _bits + 63) / 64);
+        }
+        for (; first != last; ++first)
+        {
+            push_back(static_cast<Int>(*first));
+        }
+    }
+
+    /**
+     * @brief 禁止拷贝构造
+     */
+    packedVector(const packedVector &) = delete;
+
+    /**
+     * @brief 禁止赋值
+     */
+    packedVector &operator=(const packedVector &) = delete;
+
+    /**
+     * @brief 移动构造，接管 other 的数据，other 变为空，编码方式不变
+     */
+    packedVector(packedVector &&other) noexcept
+        : _encoding(other._encoding), _bits(std::exchange(other._bits, 0)), _size(std::exchange(other._size, 0)),
+          _words(std::exchange(other._words, {})), _blocks(std::exchange(other._blocks, {})),
+          _tail(std::exchange(other._tail, {})) {}
+
+    /**
+     * @brief 移动赋值，接管 other 的数据，other 变为空，编码方式不变
+     */
+    packedVector &operator=(packedVector &&other) noexcept
+    {
+        if (this != &other)
+        {
+            _encoding = other._encoding;
+            _bits = std::exchange(other._bits, 0);
+            _size = std::exchange(other._size, 0);
+            _words = std::exchange(other._words, {});
+            _blocks = std::exchange(other._blocks, {});
+            _tail = std::exchange(other._tail, {});
+        }
+        return *this;
+    }
+
+    /**
+     * @brief 析构函数
+     */
+    ~packedVector() = default;
+
+    /**
+     * @brief 从尾部插入一个值
+     * fixed 模式下值比当前位宽更宽时会重新打包所有数据；分块模式下写入尾部缓冲区，满一块时压缩
+     * @param t 要插入的值
+     * @return 成功会返回0
+     */
+    int push_back(Int t)
+    {
+        if (_encoding == encoding::fixed)
+        {
+            unsigned need = static_cast<unsigned>(std::bit_width(static_cast<uint64_t>(t)));
+            if (need > _bits)
+            {
+                repack(need);
+            }
+            size_t end = (_size + 1) * _bits;
+            _words.resize((end + 63) / 64, 0);
+            writeBits(_words.data(), _size * _bits, _bits, t);
+        }
+        else
+        {
+            _tail.push_back(t);
+            if (_tail.size() == kBlock)
+            {
+                try
+                {
+                    sealBlock();
+                }
+                catch (...)
+                {
+                    // 压缩失败时撤销本次插入，保证 _tail 不会超过一块
+                    _tail.pop_back();
+                    throw;
+                }
+            }
+        }
+        ++_size;
+        return 0;
+    }
+
+    /**
+     * @brief 获取某个值，不检查越界
+     * @param index 索引
+     * @return 值
+     */
+    Int operator[](size_t index) const
+    {
+        if (_encoding == encoding::fixed)
+        {
+            return static_cast<Int>(readBits(_words.data(), index * _bits, _bits));
+        }
+        size_t b = index / kBlock;
+        if (b == _blocks.size())
+        {
+            return _tail[index % kBlock];
+        }
+        const block &blk = _blocks[b];
+        const uint64_t *in = _words.data() + blk.offset;
+        size_t pos = index % kBlock;
+        if (_encoding == encoding::frameOfReference)
+        {
+            return static_cast<Int>(blk.base + readBits(in, pos * blk.bits, blk.bits));
+        }
+        uint64_t v = blk.base;
+        for (size_t i = 1; i <= pos; ++i)
+        {
+            v += unzigzag(readBits(in, i * blk.bits, blk.bits));
+        }
+        return static_cast<Int>(v);
+    }
+
+    /**
+     * @brief 获取某个值，越界时抛出异常
+     * @param index 索引
+     * @return 值
+     */
+    Int at(size_t index) const
+    {
+        if (index >= _size)
+        {
+            throw std::out_of_range("Index out of range");
+        }
+        return (*this)[index];
+    }
+
+    /**
+     * @brief 修改某个值，仅支持 fixed 模式，值更宽时会重新打包
+     * @param index 索引
+     * @param t 新的值
+     * @return 成功会返回0
+     */
+    int set(size_t index, Int t)
+    {
+        if (_encoding != encoding::fixed)
+        {
+            throw std::logic_error("set is only supported in fixed encoding");
+        }
+        if (index >= _size)
+        {
+            throw std::out_of_range("Index out of range");
+        }
+        unsigned need = static_cast<unsigned>(std::bit_width(static_cast<uint64_t>(t)));
+        if (need > _bits)
+        {
+            repack(need);
+        }
+        writeBits(_words.data(), index * _bits, _bits, t);
+        return 0;
+    }
+
+    /**
+     * @brief 批量解码 [first, first + count) 到 out
+     * 按 64 个一组调用位宽特化的解码函数，是顺序扫描的推荐方式
+     * @param first 起始索引
+     * @param count 数量，超出 size 的部分会被截断
+     * @param out 输出缓冲区，至少能容纳 count 个值
+     * @return 实际解码的数量
+     */
+    size_t decode(size_t first, size_t count, Int *out) const
+    {
+        if (first >= _size)
+        {
+            return 0;
+        }
+        count = std::min(count, _size - first);
+        size_t i = first;
+        size_t end = first + count;
+        if (_encoding == encoding::fixed)
+        {
+            for (; i < end && i % kGroup != 0; ++i)
+            {
+                *out++ = (*this)[i];
+            }
+            const unpackFn<Int> fn = unpackTable()[_bits];
+            for (; i + kGroup <= end; i += kGroup, out += kGroup)
+            {
+                fn(_words.data() + (i / kGroup) * _bits, 0, out);
+            }
+            for (; i < end; ++i)
+            {
+                *out++ = (*this)[i];
+            }
+            return count;
+        }
+        std::array<Int, kBlock> buf;
+        while (i < end)
+        {
+            size_t b = i / kBlock;
+            size_t pos = i % kBlock;
+            size_t n = std::min(kBlock - pos, end - i);
+            if (b == _blocks.size())
+            {
+                std::copy_n(_tail.begin() + pos, n, out);
+            }
+            else if (pos == 0 && n == kBlock)
+            {
+                decodeBlock(b, out);
+            }
+            else
+            {
+                decodeBlock(b, buf.data());
+                std::copy_n(buf.begin() + pos, n, out);
+            }
+            i += n;
+            out += n;
+        }
+        return count;
+    }
+
+    /**
+     * @brief 获取值的数量
+     * @return 值的数量
+     */
+    size_t size() const
+    {
+        return _size;
+    }
+
+    /**
+     * @brief 检查是否为空
+     * @return 为空时返回 true
+     */
+    bool empty() const
+    {
+        return _size == 0;
+    }
+
+    /**
+     * @brief 获取 fixed 模式下的位宽
+     * @return 位宽
+     */
+    unsigned bitWidth() const
+    {
+        return _bits;
+    }
+
+    /**
+     * @brief 获取编码方式
+     * @return 编码方式
+     */
+    encoding getEncoding() const
+    {
+        return _encoding;
+    }
+
+    /**
+     * @brief 数据占用的字节数（不含对象本身和未使用的容量），用于计算压缩率
+     * @return 字节数
+     */
+    size_t bytes() const
+    {
+        return _words.size() * sizeof(uint64_t) + _blocks.size() * sizeof(block) + _tail.size() * sizeof(Int);
+    }
+
+    /**
+     * @brief 释放未使用的容量
+     * @return 成功会返回0
+     */
+    int shrink_to_fit()
+    {
+        _words.shrink_to_fit();
+        _blocks.shrink_to_fit();
+        _tail.shrink_to_fit();
+        return 0;
+    }
+
+    /**
+     * @brief 获取开始位置迭代器
+     * @return 迭代器
+     */
+    const_iterator begin() const
+    {
+        return const_iterator(this, 0);
+    }
+
+    /**
+     * @brief 获取结束位置迭代器
+     * @return 迭代器
+     */
+    const_iterator end() const
+    {
+        return const_iterator(this, _size);
+    }
+
+    /**
+     * @brief 只读的单遍（input）迭代器，每次解码一块（128 个值）到缓冲区，顺序遍历的均摊代价为 O(1)
+     * \n 值是解码出来的，operator* 按值返回；缓冲区由迭代器的所有拷贝共享，拷贝只复制一个 shared_ptr
+     * \n 因此递增任何一个拷贝后，其他拷贝不能再解引用；需要多次遍历时重新调用 begin()
+     */
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = Int;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Int;
+
+        /**
+         * @brief 后置递增的返回值，保存递增前的值，使 *it++ 可用
+         */
+        struct postIncrement
+        {
+            Int value;
+            Int operator*() const
+            {
+                return value;
+            }
+        };
+
+        const_iterator() = default;
+
+        reference operator*() const
+        {
+            return *_cur;
+        }
+
+        const_iterator &operator++()
+        {
+            ++_cur;
+            if (++_index == _blockEnd)
+            {
+                fill();
+            }
+            return *this;
+        }
+
+        postIncrement operator++(int)
+        {
+            postIncrement old{**this};
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const const_iterator &other) const
+        {
+            return _index == other._index;
+        }
+
+    private:
+        friend class packedVector;
+
+        const_iterator(const packedVector *pv, size_t index) : _pv(pv), _index(index)
+        {
+            fill();
+        }
+
+        void fill()
+        {
+            size_t start = _index - _index % kBlock;
+            _blockEnd = start + kBlock;
+            if (_index < _pv->size())
+            {
+                if (!_buf)
+                {
+                    _buf = std::make_shared<std::array<Int, kBlock>>();
+                }
+                _pv->decode(start, kBlock, _buf->data());
+                _cur = _buf->data() + (_index - start);
+            }
+        }
+
+        const packedVector *_pv = nullptr;
+        size_t _index = 0;
+        size_t _blockEnd = 0;                          ///< 当前块之后第一个值的索引，走到这里时解码下一块
+        const Int *_cur = nullptr;                     ///< 当前值在缓冲区中的位置
+        std::shared_ptr<std::array<Int, kBlock>> _buf; ///< 解码缓冲区，end() 不申请
+
+    };
+
+private:
+    /**
+     * @brief 分块模式下每块的元数据
+     */
+    struct block
+    {
+        uint64_t base;   ///< frameOfReference 为块内最小值，delta 为块内第一个值
+        size_t offset;   ///< 块数据在 _words 中的起始下标
+        unsigned bits;   ///< 块内位宽，块数据占 2 * bits 个 uint64_t
+    };
+
+    template <typename Out>
+    using unpackFn = void (*)(const uint64_t *, uint64_t, Out *);
+
+    static uint64_t readBits(const uint64_t *in, size_t pos, unsigned bits)
+    {
+        if (bits == 0)
+        {
+            return 0;
+        }
+        size_t w = pos / 64;
+        unsigned off = pos % 64;
+        uint64_t v = in[w] >> off;
+        if (off + bits > 64)
+        {
+            v |= in[w + 1] << (64 - off);
+        }
+        return bits == 64 ? v : v & ((1ULL << bits) - 1);
+    }
+
+    static void writeBits(uint64_t *out, size_t pos, unsigned bits, uint64_t v)
+    {
+        if (bits == 0)
+        {
+            return;
+        }
+        uint64_t mask = bits == 64 ? ~0ULL : (1ULL << bits) - 1;
+        size_t w = pos / 64;
+        unsigned off = pos % 64;
+        out[w] = (out[w] & ~(mask << off)) | (v << off);
+        if (off + bits > 64)
+        {
+            out[w + 1] = (out[w + 1] & ~(mask >> (64 - off))) | (v >> (64 - off));
+        }
+    }
+
+    static uint64_t zigzag(uint64_t d)
+    {
+        return (d << 1) ^ static_cast<uint64_t>(static_cast<int64_t>(d) >> 63);
+    }
+
+    static uint64_t unzigzag(uint64_t z)
+    {
+        return (z >> 1) ^ (0 - (z & 1));
+    }
+
+    /**
+     * @brief 解码 64 个位宽为 Bits 的值并加上 base，循环完全展开后移位量都是常量
+     */
+    template <unsigned Bits, typename Out>
+    static void unpack64(const uint64_t *in, uint64_t base, Out *out)
+    {
+        if constexpr (Bits == 0)
+        {
+            std::fill_n(out, kGroup, static_cast<Out>(base));
+        }
+        else
+        {
+            constexpr uint64_t mask = Bits == 64 ? ~0ULL : (1ULL << Bits) - 1;
+#pragma GCC unroll 64
+            for (unsigned j = 0; j < kGroup; ++j)
+            {
+                const unsigned pos = j * Bits;
+                const unsigned w = pos / 64;
+                const unsigned off = pos % 64;
+                uint64_t v = in[w] >> off;
+                if (off + Bits > 64)
+                {
+                    v |= in[w + 1] << (64 - off);
+                }
+                out[j] = static_cast<Out>(base + (v & mask));
+            }
+        }
+    }
+
+    template <typename Out, size_t... B>
+    static constexpr std::array<unpackFn<Out>, sizeof...(B)> makeUnpackTable(std::index_sequence<B...>)
+    {
+        return {&unpack64<B, Out>...};
+    }
+
+    /**
+     * @brief 位宽 0~64 对应的解码函数表
+     */
+    template <typename Out = Int>
+    static const std::array<unpackFn<Out>, 65> &unpackTable()
+    {
+        static constexpr std::array<unpackFn<Out>, 65> table = makeUnpackTable<Out>(std::make_index_sequence<65>());
+        return table;
+    }
+
+    /**
+     * @brief fixed 模式下把所有值按新的位宽重新打包
+     */
+    void repack(unsigned bits)
+    {
+        vector<uint64_t> words((_size * bits + 63) / 64, 0);
+        for (size_t i = 0; i < _size; ++i)
+        {
+            writeBits(words.data(), i * bits, bits, readBits(_words.data(), i * _bits, _bits));
+        }
+        _words.swap(words);
+        _bits = bits;
+    }
+
+    /**
+     * @brief 把尾部缓冲区中的 128 个值压缩成一块
+     */
+    void sealBlock()
+    {
+        std::array<uint64_t, kBlock> residual;
+        uint64_t base;
+        if (_encoding == encoding::frameOfReference)
+        {
+            base = *std::min_element(_tail.begin(), _tail.end());
+            for (size_t i = 0; i < kBlock; ++i)
+            {
+                residual[i] = _tail[i] - base;
+            }
+        }
+        else
+        {
+            base = _tail[0];
+            residual[0] = 0;
+            for (size_t i = 1; i < kBlock; ++i)
+            {
+                residual[i] = zigzag(static_cast<uint64_t>(_tail[i]) - _tail[i - 1]);
+            }
+        }
+        uint64_t all = 0;
+        for (uint64_t r : residual)
+        {
+            all |= r;
+        }
+        unsigned bits = static_cast<unsigned>(std::bit_width(all));
+        size_t offset = _words.size();
+        _words.resize(offset + 2 * bits, 0);
+        for (size_t i = 0; i < kBlock; ++i)
+        {
+            writeBits(_words.data() + offset, i * bits, bits, residual[i]);
+        }
+        try
+        {
+            _blocks.push_back(block{base, offset, bits});
+        }
+        catch (...)
+        {
+            _words.resize(offset);
+            throw;
+        }
+        _tail.clear();
+    }
+
+    /**
+     * @brief 解码一整块到 out
+     */
+    void decodeBlock(size_t b, Int *out) const
+    {
+        const block &blk = _blocks[b];
+        const uint64_t *in = _words.data() + blk.offset;
+        if (_encoding == encoding::frameOfReference)
+        {
+            const unpackFn<Int> fn = unpackTable()[blk.bits];
+            fn(in, blk.base, out);
+            fn(in + blk.bits, blk.base, out + kGroup);
+            return;
+        }
+        // delta 模式：zigzag 后的差值可能比 Int 多一位，先解码到 uint64_t 再做前缀和
+        std::array<uint64_t, kBlock> z;
+        const unpackFn<uint64_t> fn = unpackTable<uint64_t>()[blk.bits];
+        fn(in, 0, z.data());
+        fn(in + blk.bits, 0, z.data() + kGroup);
+        uint64_t v = blk.base;
+        for (size_t i = 0; i < kBlock; ++i)
+        {
+            v += unzigzag(z[i]);
+            out[i] = static_cast<Int>(v);
+        }
+    }
+
+    encoding _encoding;      ///< 编码方式
+    unsigned _bits = 0;      ///< fixed 模式的位宽
+    size_t _size = 0;        ///< 值的数量
+    vector<uint64_t> _words; ///< 压缩后的数据
+    vector<block> _blocks;   ///< 分块模式下每块的元数据
+    vector<Int> _tail;       ///< 分块模式下尚未凑满一块的值
+};
@@ -1,28 +1,63 @@
+#pragma once
 #include <iostream>
 #include <queue>
+#include <type_traits>
+#include <type_traits>
+#include "stl_radix_heap.cpp"
 
 using std::cout;
 using std::priority_queue;
 
-template <typename T>
+/**
+ * @brief 一个自定义的类，封装了 std::priority_queue 的部分功能
+ * \n 默认底层容器为 std::priority_queue<T>，是一个大顶堆，插入和删除都是 O(log n)
+ * \n 对于无符号整数键并且按非递减顺序取出的场景（事件回放、最短路），可以把底层容器换成 radixHeap<T>，此时 top 返回最小元素
+ * \n 底层容器直接作为成员保存，构造封装类本身不申请内存；底层容器的移动操作不抛出异常时，封装类的移动操作也是 noexcept
+ * \n 需要统计内存时，把底层容器指定为 priority_queue<T, vector<T, trackingAllocator<T>>>，并用分配器构造
+ * @tparam T 元素类型
+ * @tparam Queue 底层容器，需要提供 push/pop/top/empty/size
+ */
+template <typename T, typename Queue = priority_queue<T>>
 class priorityQueueWarpper
 {
 public:
    /**
-    * @brief 构造函数，创建一个新的 priority_queue 对象
+    * @brief 构造函数，创建一个空的优先队列
     */
-   priorityQueueWarpper()
-   {
-      _pq = new priority_queue<T>();
-   }
+   priorityQueueWarpper() = default;
 
    /**
-    * @brief 析构函数，释放 priority_queue 对象的内存
+    * @brief 指定分配器的构造函数，底层容器需要支持用分配器构造
+    * @param alloc 分配器
     */
-   ~priorityQueueWarpper()
-   {
-      delete _pq;
-   }
+   template <typename Alloc>
+      requires std::is_constructible_v<Queue, const Alloc &>
+   explicit priorityQueueWarpper(const Alloc &alloc) : _pq(alloc) {}
+
+   /**
+    * @brief 禁止拷贝构造
+    */
+   priorityQueueWarpper(const priorityQueueWarpper &) = delete;
+
+   /**
+    * @brief 移动构造，接管 other 的元素
+    */
+   priorityQueueWarpper(priorityQueueWarpper &&) noexcept(std::is_nothrow_move_constructible_v<Queue>) = default;
+
+   /**
+    * @brief 禁止赋值
+    */
+   priorityQueueWarpper &operator=(const priorityQueueWarpper &) = delete;
+
+   /**
+    * @brief 移动赋值，接管 other 的元素
+    */
+   priorityQueueWarpper &operator=(priorityQueueWarpper &&) noexcept(std::is_nothrow_move_assignable_v<Queue>) = default;
+
+   /**
+    * @brief 析构函数
+    */
+   ~priorityQueueWarpper() = default;
 
    /**
     * @brief 插入一个元素到优先队列中
@@ -30,7 +65,7 @@ public:
     */
    void insert(const T &t)
    {
-      _pq->push(t);
+      _pq.push(t);
    }
 
    /**
@@ -39,9 +74,9 @@ public:
     */
    void removeTop()
    {
-      if (!_pq->empty())
+      if (!_pq.empty())
       {
-         _pq->pop();
+         _pq.pop();
       }
    }
 
@@ -51,7 +86,7 @@ public:
     */
    const T &top() const
    {
-      return _pq->top();
+      return _pq.top();
    }
 
    /**
@@ -60,7 +95,7 @@ public:
     */
    bool empty() const
    {
-      return _pq->empty();
+      return _pq.empty();
    }
 
    /**
@@ -69,9 +104,15 @@ public:
     */
    size_t size() const
    {
-      return _pq->size();
+      return _pq.size();
    }
 
 private:
-   priority_queue<T> *_pq; ///< 指向 priority_queue 对象的指针
-};
\ No newline at end of file
+   Queue _pq; ///< 底层优先队列对象
+};
+
+/**
+ * @brief 以 radixHeap 为底层容器的单调最小优先队列
+ */
+template <typename T>
+using radixPriorityQueueWarpper = priorityQueueWarpper<T, radixHeap<T>>;
\ No newline at end of file
@@ -0,0 +1,202 @@
+#pragma once
+#include <array>
+#include <bit>
+#include <climits>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using std::size_t;
+using std::vector;
+
+/**
+ * @brief 从元素中取出 radixHeap 使用的无符号整数键
+ * \n 默认支持无符号整数本身，以及 std::pair<Key, Value>（按 first 排序，适合最短路的 (dist, node)）
+ */
+template <typename T>
+struct radixKeyOf
+{
+    static_assert(std::is_unsigned_v<T>, "radixHeap key must be an unsigned integer");
+    using key_type = T;
+    key_type operator()(const T &t) const
+    {
+        return t;
+    }
+};
+
+template <typename K, typename V>
+struct radixKeyOf<std::pair<K, V>>
+{
+    static_assert(std::is_unsigned_v<K>, "radixHeap key must be an unsigned integer");
+    using key_type = K;
+    key_type operator()(const std::pair<K, V> &t) const
+    {
+        return t.first;
+    }
+};
+
+/**
+ * @brief 单调整数优先队列（radix heap），作为 priorityQueueWarpper 的底层容器使用。
+ * \n 只适用于无符号整数键，并且要求取出的键单调不减：插入的键不能小于 _last，即最近一次通过 top/pop 看到的最小键
+ * \n 元素按照键与 _last 最高不同位所在的位置放入 bits+1 个桶：桶 0 存放等于 _last 的键，桶 i 存放与 _last 最高不同位为第 i-1 位的键，插入时不需要任何比较
+ * \n 桶 0 为空时，找到第一个非空桶，把 _last 更新为该桶的最小键，再把桶内元素重新分配到更低的桶中。每个元素最多下移 bits 次，removeTop 均摊 O(log C)
+ * \n 提供与 std::priority_queue 相同的 push/pop/top/empty/size 接口，但 top 返回的是最小元素
+ * \n 调试构建（未定义 NDEBUG）下插入比 _last 小的键会抛出 std::invalid_argument
+ * @tparam T 元素类型
+ * @tparam KeyOf 从元素中取出键的函数对象
+ */
+template <typename T, typename KeyOf = radixKeyOf<T>>
+class radixHeap
+{
+public:
+    using key_type = typename KeyOf::key_type;
+
+    /**
+     * @brief 无参构造函数，不申请内存
+     */
+    radixHeap() = default;
+
+    radixHeap(const radixHeap &) = default;
+    radixHeap &operator=(const radixHeap &) = default;
+
+    /**
+     * @brief 移动构造，接管 other 的桶，other 变为空
+     */
+    radixHeap(radixHeap &&other) noexcept
+        : _buckets(std::move(other._buckets)), _last(std::exchange(other._last, 0)),
+          _size(std::exchange(other._size, 0))
+    {
+        other.clearBuckets();
+    }
+
+    /**
+     * @brief 移动赋值，接管 other 的桶，other 变为空
+     */
+    radixHeap &operator=(radixHeap &&other) noexcept
+    {
+        if (this != &other)
+        {
+            _buckets = std::move(other._buckets);
+            _last = std::exchange(other._last, 0);
+            _size = std::exchange(other._size, 0);
+            other.clearBuckets();
+        }
+        return *this;
+    }
+
+    /**
+     * @brief 插入一个元素，均摊 O(1)
+     * @param t 要插入的元素，键不能小于最近一次 top/pop 看到的键
+     */
+    void push(const T &t)
+    {
+        key_type key = KeyOf()(t);
+#ifndef NDEBUG
+        if (key < _last)
+        {
+            throw std::invalid_argument("Non-monotone insert into radixHeap");
+        }
+#endif
+        _buckets[bucketIndex(key)].push_back(t);
+        ++_size;
+    }
+
+    /**
+     * @brief 移除最小元素，堆为空时行为未定义
+     */
+    void pop()
+    {
+        refill();
+        _buckets[0].pop_back();
+        --_size;
+    }
+
+    /**
+     * @brief 获取最小元素，堆为空时行为未定义
+     * 桶 0 为空时需要重新分配桶，因此桶是 mutable 的；逻辑上不改变堆的内容
+     * @return 最小元素的常量引用
+     */
+    const T &top() const
+    {
+        refill();
+        return _buckets[0].back();
+    }
+
+    /**
+     * @brief 检查堆是否为空
+     * @return 为空时返回 true
+     */
+    bool empty() const
+    {
+        return _size == 0;
+    }
+
+    /**
+     * @brief 获取元素数量
+     * @return 元素数量
+     */
+    size_t size() const
+    {
+        return _size;
+    }
+
+private:
+    static constexpr size_t kBits = sizeof(key_type) * CHAR_BIT;
+
+    /**
+     * @brief 移动后的桶处于有效但未指定的状态，清空以保证与 _size 一致
+     */
+    void clearBuckets() noexcept
+    {
+        for (vector<T> &bucket : _buckets)
+        {
+            bucket.clear();
+        }
+    }
+
+    /**
+     * @brief 键与 _last 最高不同位的位置，相等时为 0
+     */
+    size_t bucketIndex(key_type key) const
+    {
+        return static_cast<size_t>(std::bit_width(static_cast<key_type>(key ^ _last)));
+    }
+
+    /**
+     * @brief 桶 0 为空时，从第一个非空桶中取出最小键作为新的 _last，并重新分配该桶
+     */
+    void refill() const
+    {
+        if (!_buckets[0].empty())
+        {
+            return;
+        }
+        size_t i = 1;
+        while (_buckets[i].empty())
+        {
+            ++i;
+        }
+        vector<T> &bucket = _buckets[i];
+        key_type minKey = KeyOf()(bucket[0]);
+        for (const T &t : bucket)
+        {
+            key_type key = KeyOf()(t);
+            if (key < minKey)
+            {
+                minKey = key;
+            }
+        }
+        _last = minKey;
+        for (T &t : bucket)
+        {
+            _buckets[bucketIndex(KeyOf()(t))].push_back(std::move(t));
+        }
+        bucket.clear();
+    }
+
+    mutable std::array<vector<T>, kBits + 1> _buckets; ///< 按最高不同位划分的桶
+    mutable key_type _last = 0;                        ///< 最近一次取出（或正在堆顶）的键
+    size_t _size = 0;                                  ///< 元素数量
+};
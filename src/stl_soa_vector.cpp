@@ -0,0 +1,476 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+using std::size_t;
+
+/**
+ * @brief 结构体数组（structure of arrays）容器，每个字段保存在自己的连续列中。
+ * \n 只扫描一个字段时只会把这一列读进缓存，而 vectorWarpper<Struct> 会把整条记录的所有字段都读进来
+ * \n 所有列共用一块内存：列按字段顺序依次排列，每列起始地址按 64 字节对齐，方便向量化。扩容时只申请一次内存，然后逐列移动元素
+ * \n operator[] 返回由各字段引用组成的 std::tuple 作为行代理，可以用结构化绑定读写；column<I>() 返回第 I 列的 std::span
+ * \n push_back/resize 在容量不足时容量至少翻倍，超过 max_size 时抛出 std::length_error；erase/resize/reserve 的语义与 vectorWarpper 相同
+ * \n 字段构造抛出异常时整行回滚；扩容时移动构造可能抛出异常的字段改为拷贝，失败时原数据保持不变（与 std::vector 相同的强异常安全保证）
+ * @tparam Fields 各个字段的类型
+ */
+template <typename... Fields>
+class soaVector
+{
+    static_assert(sizeof...(Fields) > 0, "soaVector needs at least one field");
+
+public:
+    using row = std::tuple<Fields &...>;             ///< 可写的行代理
+    using const_row = std::tuple<const Fields &...>; ///< 只读的行代理
+
+    static constexpr size_t kColumns = sizeof...(Fields);
+    static constexpr size_t kAlign = std::max({size_t(64), alignof(Fields)...}); ///< 每列起始地址的对齐
+
+    /**
+     * @brief 无参构造函数，不申请内存
+     */
+    soaVector() = default;
+
+    /**
+     * @brief 参数化构造函数，构造 size 行默认初始化的记录
+     * @param size 行数
+     */
+    explicit soaVector(size_t size)
+    {
+        resize(size);
+    }
+
+    /**
+     * @brief 禁止拷贝构造
+     */
+    soaVector(const soaVector &) = delete;
+
+    /**
+     * @brief 禁止赋值
+     */
+    soaVector &operator=(const soaVector &) = delete;
+
+    /**
+     * @brief 移动构造，接管 other 的内存，other 变为空
+     */
+    soaVector(soaVector &&other) noexcept
+        : _data(std::exchange(other._data, nullptr)), _columns(std::exchange(other._columns, {})),
+          _size(std::exchange(other._size, 0)), _capacity(std::exchange(other._capacity, 0)) {}
+
+    /**
+     * @brief 移动赋值，释放当前内存并接管 other 的内存，other 变为空
+     */
+    soaVector &operator=(soaVector &&other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            _data = std::exchange(other._data, nullptr);
+            _columns = std::exchange(other._columns, {});
+            _size = std::exchange(other._size, 0);
+            _capacity = std::exchange(other._capacity, 0);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief 析构函数，销毁所有元素并释放内存
+     */
+    ~soaVector()
+    {
+        release();
+    }
+
+    /**
+     * @brief 从尾部插入一行
+     * 容量不足时容量翻倍，所有列一起重新分配
+     * @param values 各字段的值
+     * @return 成功会返回0
+     */
+    int push_back(Fields... values)
+    {
+        return emplace_back(std::move(values)...);
+    }
+
+    /**
+     * @brief 从尾部插入一行，各字段在列中直接构造
+     * @param values 各字段的构造参数，每个字段一个
+     * @return 成功会返回0
+     */
+    template <typename... Args>
+    int emplace_back(Args &&...values)
+    {
+        static_assert(sizeof...(Args) == kColumns, "emplace_back needs one argument per field");
+        if (_size == _capacity)
+        {
+            // 参数可能引用已有的行，先在新内存中构造新行，再搬移旧数据
+            reallocate(growTo(_size + 1), std::forward<Args>(values)...);
+        }
+        else
+        {
+            constructRow(_columns, std::index_sequence_for<Fields...>(), std::forward<Args>(values)...);
+        }
+        ++_size;
+        return 0;
+    }
+
+    /**
+     * @brief 获取某一行的代理
+     * @param index 行索引
+     * @return 各字段引用组成的 tuple
+     */
+    row operator[](size_t index)
+    {
+        return rowAt(index, std::index_sequence_for<Fields...>());
+    }
+
+    /**
+     * @brief 获取某一行的只读代理
+     * @param index 行索引
+     * @return 各字段常量引用组成的 tuple
+     */
+    const_row operator[](size_t index) const
+    {
+        return constRowAt(index, std::index_sequence_for<Fields...>());
+    }
+
+    /**
+     * @brief 获取第 I 列
+     * @return 第 I 列所有元素组成的 span，扩容后失效
+     */
+    template <size_t I>
+    std::span<std::tuple_element_t<I, std::tuple<Fields...>>> column()
+    {
+        return {columnData<I>(), _size};
+    }
+
+    /**
+     * @brief 获取第 I 列的只读视图
+     * @return 第 I 列所有元素组成的 span，扩容后失效
+     */
+    template <size_t I>
+    std::span<const std::tuple_element_t<I, std::tuple<Fields...>>> column() const
+    {
+        return {columnData<I>(), _size};
+    }
+
+    /**
+     *  @brief 移除一定范围的行
+     *  会检查越界
+     *  @param begin_index 被删除行的起始位置
+     *  @param end_index 被删除行的结束位置
+     *  @return 成功会返回0
+     */
+    int erase(const size_t begin_index, const size_t end_index)
+    {
+        if (begin_index >= _size || end_index > _size || begin_index > end_index)
+        {
+            throw std::out_of_range("Index out of range");
+        }
+        eraseColumns(begin_index, end_index, std::index_sequence_for<Fields...>());
+        _size -= end_index - begin_index;
+        return 0;
+    }
+
+    /**
+     *  @brief 重新分配行数
+     *  - 如果 new size < current size，多余的行会销毁
+     *  - 如果 new size > current size，追加默认初始化的行，超过容量时重新分配内存
+     *  @param size 调整后的行数
+     *  @return 成功会返回0
+     */
+    int resize(size_t size)
+    {
+        if (size < _size)
+        {
+            destroyRange(size, _size, std::index_sequence_for<Fields...>());
+        }
+        else if (size > _size)
+        {
+            if (size > _capacity)
+            {
+                reallocate(growTo(size));
+            }
+            for (size_t i = _size; i < size; ++i)
+            {
+                constructRow(_columns, std::index_sequence_for<Fields...>(), Fields()...);
+                ++_size;
+            }
+        }
+        _size = size;
+        return 0;
+    }
+
+    /**
+     *  @brief 重新分配容量
+     *  - 如果 n > 当前容量，所有列一起重新分配内存使容量达到 n
+     *  - 任何其他情况，不会重新分配内存
+     *  @param capacity 调整后的容量
+     *  @return 成功会返回0
+     */
+    int reserve(size_t capacity)
+    {
+        if (capacity > _capacity)
+        {
+            reallocate(capacity);
+        }
+        return 0;
+    }
+
+    /**
+     *  @brief 获取容量上限，所有列加上对齐填充的总字节数不超过 PTRDIFF_MAX
+     *  超过上限时 reserve/resize/push_back 抛出 std::length_error
+     *  @return 最大行数
+     */
+    static constexpr size_t max_size()
+    {
+        return (static_cast<size_t>(PTRDIFF_MAX) - kColumns * kAlign) / (sizeof(Fields) + ...);
+    }
+
+    /**
+     * @brief 移除所有行，不释放内存
+     * @return 成功会返回0
+     */
+    int clear()
+    {
+        destroyRange(0, _size, std::index_sequence_for<Fields...>());
+        _size = 0;
+        return 0;
+    }
+
+    /**
+     *  @brief 获取容量
+     *  @return 返回容器的容量
+     */
+    size_t capacity() const
+    {
+        return _capacity;
+    }
+
+    /**
+     *  @brief 获取行数
+     *  @return 返回容器的行数
+     */
+    size_t size() const
+    {
+        return _size;
+    }
+
+    /**
+     *  @brief 检查是否为空
+     *  @return 为空时返回 true
+     */
+    bool empty() const
+    {
+        return _size == 0;
+    }
+
+private:
+    template <size_t I>
+    using field = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+    template <size_t I>
+    field<I> *columnData() const
+    {
+        return static_cast<field<I> *>(_columns[I]);
+    }
+
+    template <size_t... I>
+    row rowAt(size_t index, std::index_sequence<I...>)
+    {
+        return row(columnData<I>()[index]...);
+    }
+
+    template <size_t... I>
+    const_row constRowAt(size_t index, std::index_sequence<I...>) const
+    {
+        return const_row(columnData<I>()[index]...);
+    }
+
+    /**
+     * @brief 在 columns 的第 _size 行构造各字段，容量必须足够
+     * 某个字段的构造抛出异常时，销毁这一行已经构造的字段后重新抛出，_size 不变
+     */
+    template <size_t... I, typename... Args>
+    void constructRow(const std::array<void *, kColumns> &columns, std::index_sequence<I...>, Args &&...values)
+    {
+        size_t built = 0;
+        try
+        {
+            ((::new (static_cast<void *>(static_cast<field<I> *>(columns[I]) + _size)) field<I>(std::forward<Args>(values)), ++built), ...);
+        }
+        catch (...)
+        {
+            ((I < built ? std::destroy_at(static_cast<field<I> *>(columns[I]) + _size) : void()), ...);
+            throw;
+        }
+    }
+
+    template <size_t... I>
+    void destroyRow(const std::array<void *, kColumns> &columns, std::index_sequence<I...>)
+    {
+        (std::destroy_at(static_cast<field<I> *>(columns[I]) + _size), ...);
+    }
+
+    /**
+     * @brief 容纳 n 行时扩容后的容量：至少翻倍，保证连续追加均摊 O(1)
+     */
+    size_t growTo(size_t n) const
+    {
+        if (n > max_size())
+        {
+            throw std::length_error("soaVector is too large");
+        }
+        return std::max(n, std::min(_capacity * 2, max_size()));
+    }
+
+    template <size_t... I>
+    void destroyRange(size_t first, size_t last, std::index_sequence<I...>)
+    {
+        (std::destroy(columnData<I>() + first, columnData<I>() + last), ...);
+    }
+
+    template <size_t... I>
+    void eraseColumns(size_t first, size_t last, std::index_sequence<I...>)
+    {
+        (eraseColumn<I>(first, last), ...);
+    }
+
+    template <size_t I>
+    void eraseColumn(size_t first, size_t last)
+    {
+        field<I> *col = columnData<I>();
+        std::move(col + last, col + _size, col + first);
+        std::destroy(col + _size - (last - first), col + _size);
+    }
+
+    /**
+     * @brief 计算容量为 capacity 时各列在整块内存中的偏移和总大小，超过 max_size 时抛出 std::length_error
+     */
+    static std::pair<std::array<size_t, kColumns>, size_t> layout(size_t capacity)
+    {
+        if (capacity > max_size())
+        {
+            throw std::length_error("soaVector is too large");
+        }
+        std::array<size_t, kColumns> offsets{};
+        constexpr std::array<size_t, kColumns> sizes{sizeof(Fields)...};
+        size_t offset = 0;
+        for (size_t i = 0; i < kColumns; ++i)
+        {
+            offset = (offset + kAlign - 1) / kAlign * kAlign;
+            offsets[i] = offset;
+            offset += sizes[i] * capacity;
+        }
+        return {offsets, offset};
+    }
+
+    /**
+     * @brief 申请一块新内存容纳 capacity 行，把所有列移动过去
+     * 指定了 row 时，先在新内存的第 _size 行构造新行再搬移旧数据，因此 row 可以引用已有的行（与 std::vector 相同）
+     */
+    template <typename... Args>
+    void reallocate(size_t capacity, Args &&...row)
+    {
+        auto [offsets, bytes] = layout(capacity);
+        std::byte *data = static_cast<std::byte *>(::operator new(bytes, std::align_val_t(kAlign)));
+        std::array<void *, kColumns> columns;
+        for (size_t i = 0; i < kColumns; ++i)
+        {
+            columns[i] = data + offsets[i];
+        }
+        try
+        {
+            if constexpr (sizeof...(Args) > 0)
+            {
+                constructRow(columns, std::index_sequence_for<Fields...>(), std::forward<Args>(row)...);
+            }
+            try
+            {
+                moveColumns(columns, std::index_sequence_for<Fields...>());
+            }
+            catch (...)
+            {
+                if constexpr (sizeof...(Args) > 0)
+                {
+                    destroyRow(columns, std::index_sequence_for<Fields...>());
+                }
+                throw;
+            }
+        }
+        catch (...)
+        {
+            ::operator delete(data, std::align_val_t(kAlign));
+            throw;
+        }
+        size_t size = _size;
+        release();
+        _data = data;
+        _columns = columns;
+        _size = size;
+        _capacity = capacity;
+    }
+
+    /**
+     * @brief 把所有列转移到 to 中
+     * 与 std::move_if_noexcept 相同：移动构造可能抛出异常并且可以拷贝时改为拷贝，失败时原数据保持不变
+     * 某一列转移失败时，销毁已经转移完成的列后重新抛出
+     */
+    template <size_t... I>
+    void moveColumns(const std::array<void *, kColumns> &to, std::index_sequence<I...>)
+    {
+        size_t done = 0;
+        try
+        {
+            ((moveColumn<I>(static_cast<field<I> *>(to[I])), ++done), ...);
+        }
+        catch (...)
+        {
+            ((I < done ? void(std::destroy_n(static_cast<field<I> *>(to[I]), _size)) : void()), ...);
+            throw;
+        }
+    }
+
+    template <size_t I>
+    void moveColumn(field<I> *to)
+    {
+        using F = field<I>;
+        if constexpr (std::is_nothrow_move_constructible_v<F> || !std::is_copy_constructible_v<F>)
+        {
+            std::uninitialized_move(columnData<I>(), columnData<I>() + _size, to);
+        }
+        else
+        {
+            std::uninitialized_copy(columnData<I>(), columnData<I>() + _size, to);
+        }
+    }
+
+    /**
+     * @brief 销毁所有元素并释放内存
+     */
+    void release()
+    {
+        if (_data)
+        {
+            destroyRange(0, _size, std::index_sequence_for<Fields...>());
+            ::operator delete(_data, std::align_val_t(kAlign));
+        }
+        _data = nullptr;
+        _columns = {};
+        _size = 0;
+        _capacity = 0;
+    }
+
+    std::byte *_data = nullptr;              ///< 所有列共用的内存
+    std::array<void *, kColumns> _columns{}; ///< 各列的起始地址
+    size_t _size = 0;                        ///< 行数
+    size_t _capacity = 0;                    ///< 容量
+};
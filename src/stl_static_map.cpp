@@ -0,0 +1,323 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+using std::size_t;
+
+/**
+ * @brief staticMap 默认使用的带种子的 constexpr 哈希
+ * \n 整数使用 splitmix64，std::string_view 使用 FNV-1a
+ */
+template <typename K>
+struct staticHash
+{
+    static_assert(std::is_integral_v<K> || std::is_enum_v<K>, "staticHash supports integers, enums and std::string_view");
+    constexpr uint64_t operator()(const K &key, uint64_t seed) const
+    {
+        uint64_t x = static_cast<uint64_t>(key) + seed + 0x9e3779b97f4a7c15ULL;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    }
+};
+
+template <>
+struct staticHash<std::string_view>
+{
+    constexpr uint64_t operator()(std::string_view key, uint64_t seed) const
+    {
+        uint64_t h = 0xcbf29ce484222325ULL ^ seed;
+        for (char c : key)
+        {
+            h = (h ^ static_cast<unsigned char>(c)) * 0x100000001b3ULL;
+        }
+        return h ^ (h >> 32);
+    }
+};
+
+/**
+ * @brief 编译期构造的只读哈希表，接口与 unorderedMapWarpper 的 operator[]/at 保持一致，所有操作都是 constexpr。
+ * \n 键集合在构造时确定，构造时用 hash-and-displace 算法计算最小完美哈希：
+ * \n - 第一层用固定种子把 N 个键分到 N 个桶中
+ * \n - 按桶的大小从大到小处理，为每个桶寻找一个种子，使桶内所有键哈希到互不冲突的空槽；只有一个键的桶直接放到任意空槽，记录槽号
+ * \n 分桶和按桶大小排序都用计数排序，除种子搜索外构造是 O(N)，上千个键的表也能在编译期构造
+ * \n 查找时计算两次哈希、比较一次键，没有探测和链表；N 个键正好占 N 个槽
+ * \n constexpr 变量在编译期完成构造，连同完美哈希的位移表一起放入只读数据段（.rodata），启动时没有任何初始化开销，也不会申请堆内存
+ * \n 不支持插入新键（完美哈希依赖于固定的键集合）；erase 只把槽标记为已删除
+ * \n 查找不存在的键时抛出 std::out_of_range，在常量表达式中会直接导致编译失败；键重复时构造抛出 std::invalid_argument
+ * @tparam K 键类型，字符串请使用 std::string_view
+ * @tparam V 值类型，需要可默认构造
+ * @tparam N 键的数量
+ * @tparam Hash 带种子的哈希函数对象
+ */
+template <typename K, typename V, size_t N, typename Hash = staticHash<K>>
+class staticMap
+{
+    static_assert(N > 0, "staticMap needs at least one entry");
+
+public:
+    using value_type = std::pair<K, V>;
+
+    /**
+     * @brief 用键值对构造，并计算完美哈希
+     * @param entries 键值对，键不能重复
+     */
+    constexpr explicit staticMap(const std::array<value_type, N> &entries)
+    {
+        build(entries);
+    }
+
+    /**
+     * @brief 获取某个键对应的值，键不存在时抛出 std::out_of_range
+     * @param key 键
+     * @return 值的引用
+     */
+    constexpr V &operator[](const K &key)
+    {
+        return _values[slotOf(key)];
+    }
+
+    constexpr const V &operator[](const K &key) const
+    {
+        return _values[slotOf(key)];
+    }
+
+    /**
+     * @brief 获取某个键对应的值，键不存在时抛出 std::out_of_range
+     * @param key 键
+     * @return 值的引用
+     */
+    constexpr V &at(const K &key)
+    {
+        return _values[slotOf(key)];
+    }
+
+    constexpr const V &at(const K &key) const
+    {
+        return _values[slotOf(key)];
+    }
+
+    /**
+     * @brief 查找某个键
+     * @param key 键
+     * @return 存在时返回值的指针，否则返回 nullptr
+     */
+    constexpr const V *find(const K &key) const
+    {
+        size_t slot = probe(key);
+        return slot == N ? nullptr : &_values[slot];
+    }
+
+    /**
+     * @brief 检查某个键是否存在
+     * @param key 键
+     * @return 存在时返回 true
+     */
+    constexpr bool contains(const K &key) const
+    {
+        return probe(key) != N;
+    }
+
+    /**
+     * @brief 删除某个键，只做标记，不改变完美哈希
+     * @param key 键
+     * @return 删除的数量，0 或 1
+     */
+    constexpr size_t erase(const K &key)
+    {
+        size_t slot = probe(key);
+        if (slot == N)
+        {
+            return 0;
+        }
+        _live[slot] = false;
+        _values[slot] = V();
+        --_size;
+        return 1;
+    }
+
+    /**
+     * @brief 获取键的数量
+     * @return 键的数量
+     */
+    constexpr size_t size() const
+    {
+        return _size;
+    }
+
+    /**
+     * @brief 检查是否为空
+     * @return 为空时返回 true
+     */
+    constexpr bool empty() const
+    {
+        return _size == 0;
+    }
+
+private:
+    static constexpr uint64_t kBucketSeed = 0x5bd1e995ULL;
+    static constexpr int64_t kMaxAttempts = 1 << 20;
+
+    /**
+     * @brief 计算完美哈希并填充各个槽
+     */
+    constexpr void build(const std::array<value_type, N> &entries)
+    {
+        // 按桶做计数排序：bucketStart 为各桶在 members 中的起始位置，同一个桶的键在 members 中连续
+        std::array<size_t, N> bucketOf{};
+        std::array<size_t, N + 1> bucketStart{};
+        for (size_t i = 0; i < N; ++i)
+        {
+            bucketOf[i] = Hash()(entries[i].first, kBucketSeed) % N;
+            ++bucketStart[bucketOf[i] + 1];
+        }
+        for (size_t b = 0; b < N; ++b)
+        {
+            bucketStart[b + 1] += bucketStart[b];
+        }
+        std::array<size_t, N> members{};
+        {
+            std::array<size_t, N> fill{};
+            for (size_t i = 0; i < N; ++i)
+            {
+                size_t b = bucketOf[i];
+                members[bucketStart[b] + fill[b]++] = i;
+            }
+        }
+
+        // 桶按大小从大到小处理：再按桶的大小做一次计数排序，大小不超过 N
+        std::array<size_t, N> order{};
+        {
+            std::array<size_t, N + 2> sizeStart{};
+            for (size_t b = 0; b < N; ++b)
+            {
+                ++sizeStart[N - (bucketStart[b + 1] - bucketStart[b]) + 1];
+            }
+            for (size_t k = 0; k <= N; ++k)
+            {
+                sizeStart[k + 1] += sizeStart[k];
+            }
+            for (size_t b = 0; b < N; ++b)
+            {
+                order[sizeStart[N - (bucketStart[b + 1] - bucketStart[b])]++] = b;
+            }
+        }
+
+        std::array<bool, N> used{};
+        std::array<size_t, N> slots{};
+        size_t nextFree = 0;
+        for (size_t b : order)
+        {
+            const size_t *bucket = members.data() + bucketStart[b];
+            size_t count = bucketStart[b + 1] - bucketStart[b];
+            if (count == 0)
+            {
+                // 桶按大小降序，之后的桶都为空
+                break;
+            }
+            if (count == 1)
+            {
+                // 只有一个键：直接放到下一个空槽，位移表中记录 -(槽号 + 1)
+                while (used[nextFree])
+                {
+                    ++nextFree;
+                }
+                place(entries[bucket[0]], nextFree, used);
+                _displace[b] = -static_cast<int64_t>(nextFree) - 1;
+                continue;
+            }
+            int64_t seed = 1;
+            for (;; ++seed)
+            {
+                if (seed > kMaxAttempts)
+                {
+                    throw std::invalid_argument("Failed to build perfect hash");
+                }
+                bool ok = true;
+                for (size_t m = 0; m < count && ok; ++m)
+                {
+                    slots[m] = Hash()(entries[bucket[m]].first, static_cast<uint64_t>(seed)) % N;
+                    ok = !used[slots[m]];
+                    for (size_t p = 0; p < m && ok; ++p)
+                    {
+                        if (slots[p] == slots[m])
+                        {
+                            // 同一个种子下相同的槽说明键重复，换种子也无法解决
+                            if (entries[bucket[p]].first == entries[bucket[m]].first)
+                            {
+                                throw std::invalid_argument("Duplicate key in staticMap");
+                            }
+                            ok = false;
+                        }
+                    }
+                }
+                if (ok)
+                {
+                    break;
+                }
+            }
+            for (size_t m = 0; m < count; ++m)
+            {
+                place(entries[bucket[m]], slots[m], used);
+            }
+            _displace[b] = seed;
+        }
+        _size = N;
+    }
+
+    constexpr void place(const value_type &entry, size_t slot, std::array<bool, N> &used)
+    {
+        used[slot] = true;
+        _keys[slot] = entry.first;
+        _values[slot] = entry.second;
+        _live[slot] = true;
+    }
+
+    /**
+     * @brief 计算键所在的槽，不存在时返回 N
+     */
+    constexpr size_t probe(const K &key) const
+    {
+        int64_t d = _displace[Hash()(key, kBucketSeed) % N];
+        size_t slot = d < 0 ? static_cast<size_t>(-d - 1) : Hash()(key, static_cast<uint64_t>(d)) % N;
+        return _live[slot] && _keys[slot] == key ? slot : N;
+    }
+
+    constexpr size_t slotOf(const K &key) const
+    {
+        size_t slot = probe(key);
+        if (slot == N)
+        {
+            throw std::out_of_range("Key not found in staticMap");
+        }
+        return slot;
+    }
+
+    std::array<K, N> _keys{};          ///< 各槽的键
+    std::array<V, N> _values{};        ///< 各槽的值
+    std::array<bool, N> _live{};       ///< 槽是否有效
+    std::array<int64_t, N> _displace{}; ///< 各桶的种子，负数表示直接记录的槽号
+    size_t _size = 0;                  ///< 键的数量
+};
+
+/**
+ * @brief 构造 staticMap，N 由键值对的数量推导
+ * \n 用法：constexpr auto opcodes = makeStaticMap<std::string_view, int>({{{"add", 1}, {"sub", 2}}});
+ * @param entries 键值对
+ * @return staticMap
+ */
+template <typename K, typename V, typename Hash = staticHash<K>, size_t N>
+constexpr staticMap<K, V, N, Hash> makeStaticMap(const std::pair<K, V> (&entries)[N])
+{
+    std::array<std::pair<K, V>, N> arr{};
+    for (size_t i = 0; i < N; ++i)
+    {
+        arr[i] = entries[i];
+    }
+    return staticMap<K, V, N, Hash>(arr);
+}
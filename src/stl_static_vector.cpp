@@ -0,0 +1,263 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+using std::size_t;
+
+/**
+ * @brief 固定容量的数组，接口与 vectorWarpper 保持一致，所有操作都是 constexpr。
+ * \n 元素保存在对象内部的 std::array 中，不会申请堆内存；constexpr 变量会在编译期构造并放入只读数据段（.rodata）
+ * \n 容量在编译期确定，超出容量时抛出 std::length_error，在常量表达式中会直接导致编译失败
+ * \n 为了满足 C++20 的 constexpr 要求，T 需要可默认构造，未使用的位置保存默认构造的对象
+ * @tparam T 元素类型
+ * @tparam N 容量
+ */
+template <typename T, size_t N>
+class staticVector
+{
+public:
+    using iterator = typename std::array<T, N>::iterator;
+    using const_iterator = typename std::array<T, N>::const_iterator;
+
+    /**
+     * @brief 无参构造函数
+     */
+    constexpr staticVector() = default;
+
+    /**
+     * @brief 用初始化列表构造
+     * @param init 初始元素，数量不能超过 N
+     */
+    constexpr staticVector(std::initializer_list<T> init)
+    {
+        for (const T &t : init)
+        {
+            push_back(t);
+        }
+    }
+
+    /**
+     * @brief 获取开始位置迭代器
+     * @return 迭代器
+     */
+    constexpr iterator begin()
+    {
+        return _data.begin();
+    }
+
+    constexpr const_iterator begin() const
+    {
+        return _data.begin();
+    }
+
+    /**
+     * @brief 获取结束位置迭代器
+     * @return 迭代器
+     */
+    constexpr iterator end()
+    {
+        return _data.begin() + _size;
+    }
+
+    constexpr const_iterator end() const
+    {
+        return _data.begin() + _size;
+    }
+
+    /**
+     *  @brief 从尾部插入一个对象
+     *  容量不足时抛出 std::length_error
+     *  @param t 一个类型为T的元素
+     *  @return 成功会返回0
+     */
+    constexpr int push_back(const T &t)
+    {
+        checkFull();
+        _data[_size++] = t;
+        return 0;
+    }
+
+    constexpr int push_back(T &&t)
+    {
+        checkFull();
+        _data[_size++] = std::move(t);
+        return 0;
+    }
+
+    /**
+     *  @brief 从尾部构造一个对象
+     *  容量不足时抛出 std::length_error
+     *  @param args 构造参数
+     *  @return 成功会返回0
+     */
+    template <typename... Args>
+    constexpr int emplace_back(Args &&...args)
+    {
+        checkFull();
+        _data[_size++] = T(std::forward<Args>(args)...);
+        return 0;
+    }
+
+    /**
+     *  @brief 移除最后一个元素
+     *  @return 成功会返回0
+     */
+    constexpr int pop_back()
+    {
+        if (_size == 0)
+        {
+            throw std::out_of_range("pop_back on empty staticVector");
+        }
+        _data[--_size] = T();
+        return 0;
+    }
+
+    /**
+     *  @brief 任意位置插入一个对象，插入元素位置之后的所有元素都往后平移1位
+     *  @param index 插入元素的索引
+     *  @param t 一个类型为T的元素
+     *  @return 成功会返回0
+     */
+    constexpr int insert(const size_t index, T t)
+    {
+        if (index > _size)
+        {
+            throw std::out_of_range("Index out of range");
+        }
+        checkFull();
+        for (size_t i = _size; i > index; --i)
+        {
+            _data[i] = std::move(_data[i - 1]);
+        }
+        _data[index] = std::move(t);
+        ++_size;
+        return 0;
+    }
+
+    /**
+     *  @brief 移除一定范围的元素
+     *  会检查越界
+     *  @param begin_index 被删除元素的起始位置
+     *  @param end_index 被删除元素的结束位置
+     *  @return 成功会返回0
+     */
+    constexpr int erase(const size_t begin_index, const size_t end_index)
+    {
+        if (begin_index >= _size || end_index > _size || begin_index > end_index)
+        {
+            throw std::out_of_range("Index out of range");
+        }
+        size_t count = end_index - begin_index;
+        for (size_t i = begin_index; i + count < _size; ++i)
+        {
+            _data[i] = std::move(_data[i + count]);
+        }
+        for (size_t i = _size - count; i < _size; ++i)
+        {
+            _data[i] = T();
+        }
+        _size -= count;
+        return 0;
+    }
+
+    /**
+     *  @brief 重新设置元素数量，新增的元素默认构造
+     *  @param size 调整后的大小，不能超过 N
+     *  @return 成功会返回0
+     */
+    constexpr int resize(size_t size)
+    {
+        if (size > N)
+        {
+            throw std::length_error("staticVector capacity exceeded");
+        }
+        for (size_t i = size; i < _size; ++i)
+        {
+            _data[i] = T();
+        }
+        _size = size;
+        return 0;
+    }
+
+    /**
+     *  @brief 获取某个元素的引用，不检查越界
+     *  @param index 需要获取元素的索引
+     *  @return 元素的引用
+     */
+    constexpr T &operator[](const size_t index)
+    {
+        return _data[index];
+    }
+
+    constexpr const T &operator[](const size_t index) const
+    {
+        return _data[index];
+    }
+
+    /**
+     *  @brief 获取某个元素的引用，越界时抛出 std::out_of_range
+     *  @param index 需要获取元素的索引
+     *  @return 元素的引用
+     */
+    constexpr T &at(const size_t index)
+    {
+        checkIndex(index);
+        return _data[index];
+    }
+
+    constexpr const T &at(const size_t index) const
+    {
+        checkIndex(index);
+        return _data[index];
+    }
+
+    /**
+     *  @brief 获取容量
+     *  @return 返回容器的容量
+     */
+    static constexpr size_t capacity()
+    {
+        return N;
+    }
+
+    /**
+     *  @brief 获取大小
+     *  @return 返回容器的大小
+     */
+    constexpr size_t size() const
+    {
+        return _size;
+    }
+
+    /**
+     *  @brief 检查是否为空
+     *  @return 为空时返回 true
+     */
+    constexpr bool empty() const
+    {
+        return _size == 0;
+    }
+
+private:
+    constexpr void checkFull() const
+    {
+        if (_size == N)
+        {
+            throw std::length_error("staticVector capacity exceeded");
+        }
+    }
+
+    constexpr void checkIndex(size_t index) const
+    {
+        if (index >= _size)
+        {
+            throw std::out_of_range("Index out of range");
+        }
+    }
+
+    std::array<T, N> _data{}; ///< 元素存储
+    size_t _size = 0;         ///< 元素数量
+};
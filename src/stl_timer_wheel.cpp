@@ -0,0 +1,443 @@
+#pragma once
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "stl_priority.cpp"
+
+using std::size_t;
+using std::vector;
+
+/**
+ * @brief 分层时间轮定时器，与 priorityQueueWarpper 配合使用。
+ * \n 用堆管理大量超时时，插入和删除都是 O(log n)，而且不支持取消。时间轮把定时器按到期 tick 挂到槽位链表上，schedule/cancel 都是 O(1)
+ * \n 共 Levels 层，每层 256 个槽。第 i 层覆盖距当前 tick 小于 2^(8*(i+1)) 的定时器，高层槽位在低层转完一圈时级联（cascade）到低层
+ * \n 每层用 256 位的占用位图记录非空槽位，advance 直接跳到下一个需要触发或级联的 tick，代价与经过的 tick 数无关
+ * \n 超出时间轮范围（2^(8*Levels) 个 tick）的定时器放入 priorityQueueWarpper 实现的最小堆，进入范围后再迁移到时间轮
+ * \n 定时器节点保存在连续的节点池中，槽位链表用下标串联，释放的节点进入空闲链表复用，避免每个定时器单独分配内存
+ * \n 定时器句柄由节点下标和代数（generation）组成，节点复用后旧句柄自动失效，cancel 过期句柄是安全的
+ * \n 堆中的定时器取消时只做标记，出堆时再丢弃（惰性删除）
+ * @tparam T 定时器携带的数据，需要可默认构造
+ * @tparam Levels 时间轮层数
+ */
+template <typename T, size_t Levels = 4>
+class timerWheel
+{
+    static_assert(Levels >= 1 && Levels <= 7, "Levels must be in [1, 7]");
+
+public:
+    using timerId = uint64_t; ///< 定时器句柄，高 32 位为代数，低 32 位为节点下标
+
+    /**
+     * @brief 构造函数
+     * @param resolution 每个 tick 对应的时间单位数，必须为正数
+     * @param start 起始时间，与 schedule/advance 使用同一时间单位
+     */
+    explicit timerWheel(uint64_t resolution = 1, uint64_t start = 0)
+        : _resolution(resolution), _slots(Levels * kSlots, kNil), _occupied(Levels * kSlots / kWordBits, 0)
+    {
+        if (resolution == 0)
+        {
+            throw std::invalid_argument("Resolution must be positive");
+        }
+        _now = start / _resolution;
+    }
+
+    /**
+     * @brief 禁止拷贝构造
+     */
+    timerWheel(const timerWheel &) = delete;
+
+    /**
+     * @brief 禁止赋值
+     */
+    timerWheel &operator=(const timerWheel &) = delete;
+
+    /**
+     * @brief 添加一个定时器
+     * 到期时间向上取整到 tick，因此定时器不会早于 deadline 触发；已经过期的 deadline 会在下一次 advance 时触发
+     * @param deadline 到期的绝对时间
+     * @param t 定时器携带的数据
+     * @return 定时器句柄
+     */
+    timerId schedule(uint64_t deadline, T t)
+    {
+        uint64_t expire = deadline / _resolution + (deadline % _resolution != 0);
+        if (expire <= _now)
+        {
+            expire = _now + 1;
+        }
+        uint32_t index = allocNode();
+        _nodes[index].payload = std::move(t);
+        _nodes[index].expire = expire;
+        if (expire - _now < kHorizon)
+        {
+            link(index);
+        }
+        else
+        {
+            _nodes[index].state = kOverflow;
+            _overflow.insert(overflowEntry{expire, index, _nodes[index].gen});
+        }
+        ++_size;
+        return (static_cast<uint64_t>(_nodes[index].gen) << 32) | index;
+    }
+
+    /**
+     * @brief 取消一个定时器
+     * @param id schedule 返回的句柄
+     * @return 定时器存在且未触发时返回 true，否则返回 false
+     */
+    bool cancel(timerId id)
+    {
+        uint32_t index = static_cast<uint32_t>(id);
+        uint32_t gen = static_cast<uint32_t>(id >> 32);
+        if (index >= _nodes.size() || _nodes[index].gen != gen)
+        {
+            return false;
+        }
+        node &n = _nodes[index];
+        if (n.state == kWheel)
+        {
+            unlink(index);
+            freeNode(index);
+        }
+        else if (n.state == kOverflow)
+        {
+            // 堆中的条目在出堆时通过代数判断丢弃，这里只回收节点
+            freeNode(index);
+        }
+        else
+        {
+            return false;
+        }
+        --_size;
+        return true;
+    }
+
+    /**
+     * @brief 推进时间轮到 now，触发所有到期的定时器
+     * 借助占用位图跳过空槽位，只在有定时器到期、非空槽位级联或溢出定时器进入范围的 tick 上停下
+     * 代价与停下的次数成正比（每次 O(Levels)，级联的代价均摊到每个定时器上），与经过的 tick 数无关
+     * @param now 当前的绝对时间
+     * @param onExpire 批量回调，参数为 vector<T>&，本次推进中到期的所有数据按到期顺序一次性传入
+     * @return 本次触发的定时器数量
+     */
+    template <typename F>
+    size_t advance(uint64_t now, F &&onExpire)
+    {
+        uint64_t target = now / _resolution;
+        _expired.clear();
+        while (_now < target)
+        {
+            // 中间的 tick 既没有定时器到期也没有级联，直接跳过
+            _now = nextEvent(target) - 1;
+            tick();
+        }
+        if (!_expired.empty())
+        {
+            onExpire(_expired);
+        }
+        return _expired.size();
+    }
+
+    /**
+     * @brief 推进时间轮到 now，丢弃到期数据
+     * @param now 当前的绝对时间
+     * @return 本次触发的定时器数量
+     */
+    size_t advance(uint64_t now)
+    {
+        return advance(now, [](vector<T> &) {});
+    }
+
+    /**
+     * @brief 获取未触发且未取消的定时器数量
+     * @return 定时器数量
+     */
+    size_t size() const
+    {
+        return _size;
+    }
+
+    /**
+     * @brief 检查是否没有待触发的定时器
+     * @return 没有时返回 true
+     */
+    bool empty() const
+    {
+        return _size == 0;
+    }
+
+    /**
+     * @brief 获取当前时间轮所在的 tick
+     * @return 当前 tick
+     */
+    uint64_t currentTick() const
+    {
+        return _now;
+    }
+
+private:
+    static constexpr size_t kSlotBits = 8;
+    static constexpr uint64_t kSlots = 1ULL << kSlotBits;
+    static constexpr uint64_t kSlotMask = kSlots - 1;
+    static constexpr uint64_t kHorizon = 1ULL << (kSlotBits * Levels); ///< 时间轮能容纳的最大 tick 跨度
+    static constexpr uint32_t kNil = UINT32_MAX;
+    static constexpr uint64_t kWordBits = 64;
+
+    enum nodeState : uint8_t
+    {
+        kFree,
+        kWheel,
+        kOverflow
+    };
+
+    /**
+     * @brief 节点池中的定时器节点
+     */
+    struct node
+    {
+        T payload{};
+        uint64_t expire = 0;
+        uint32_t prev = kNil;
+        uint32_t next = kNil;
+        uint32_t gen = 0;
+        uint32_t slot = 0;
+        nodeState state = kFree;
+    };
+
+    /**
+     * @brief 溢出堆中的条目，比较运算符取反使 priority_queue 成为最小堆
+     */
+    struct overflowEntry
+    {
+        uint64_t expire;
+        uint32_t index;
+        uint32_t gen;
+        bool operator<(const overflowEntry &other) const
+        {
+            return expire > other.expire;
+        }
+    };
+
+    uint32_t allocNode()
+    {
+        if (_freeHead != kNil)
+        {
+            uint32_t index = _freeHead;
+            _freeHead = _nodes[index].next;
+            return index;
+        }
+        if (_nodes.size() >= kNil)
+        {
+            throw std::length_error("Too many timers");
+        }
+        _nodes.emplace_back();
+        return static_cast<uint32_t>(_nodes.size() - 1);
+    }
+
+    void freeNode(uint32_t index)
+    {
+        node &n = _nodes[index];
+        n.payload = T{};
+        n.state = kFree;
+        ++n.gen;
+        n.prev = kNil;
+        n.next = _freeHead;
+        _freeHead = index;
+    }
+
+    /**
+     * @brief 按距当前 tick 的差值选择层级和槽位，插入槽位链表头部
+     */
+    void link(uint32_t index)
+    {
+        node &n = _nodes[index];
+        uint64_t delta = n.expire - _now;
+        size_t level = 0;
+        while (delta >= (1ULL << (kSlotBits * (level + 1))))
+        {
+            ++level;
+        }
+        uint32_t slot = static_cast<uint32_t>(level * kSlots + ((n.expire >> (kSlotBits * level)) & kSlotMask));
+        n.slot = slot;
+        n.state = kWheel;
+        n.prev = kNil;
+        n.next = _slots[slot];
+        if (n.next != kNil)
+        {
+            _nodes[n.next].prev = index;
+        }
+        _slots[slot] = index;
+        _occupied[slot / kWordBits] |= 1ULL << (slot % kWordBits);
+    }
+
+    void unlink(uint32_t index)
+    {
+        node &n = _nodes[index];
+        if (n.prev != kNil)
+        {
+            _nodes[n.prev].next = n.next;
+        }
+        else
+        {
+            _slots[n.slot] = n.next;
+            if (n.next == kNil)
+            {
+                clearOccupied(n.slot);
+            }
+        }
+        if (n.next != kNil)
+        {
+            _nodes[n.next].prev = n.prev;
+        }
+    }
+
+    /**
+     * @brief 把某一层的某个槽位整体摘下，重新按当前 tick 插入
+     */
+    void cascade(size_t level, uint64_t index)
+    {
+        uint32_t slot = static_cast<uint32_t>(level * kSlots + index);
+        uint32_t cur = _slots[slot];
+        _slots[slot] = kNil;
+        clearOccupied(slot);
+        while (cur != kNil)
+        {
+            uint32_t next = _nodes[cur].next;
+            link(cur);
+            cur = next;
+        }
+    }
+
+    void clearOccupied(uint32_t slot)
+    {
+        _occupied[slot / kWordBits] &= ~(1ULL << (slot % kWordBits));
+    }
+
+    /**
+     * @brief 从第 level 层的槽位 start 开始（包含 start）循环查找第一个非空槽位
+     * @return 非空槽位与 start 的距离，整层为空时返回 kSlots
+     */
+    uint64_t findOccupied(size_t level, uint64_t start) const
+    {
+        const uint64_t *bits = &_occupied[level * kSlots / kWordBits];
+        uint64_t scanned = 0;
+        while (scanned < kSlots)
+        {
+            uint64_t pos = (start + scanned) & kSlotMask;
+            uint64_t word = bits[pos / kWordBits] >> (pos % kWordBits);
+            if (word != 0)
+            {
+                // 回绕后的最后一个字中，start 之后的位已经检查过且为空，因此结果一定小于 kSlots
+                return scanned + std::countr_zero(word);
+            }
+            scanned += kWordBits - pos % kWordBits;
+        }
+        return kSlots;
+    }
+
+    /**
+     * @brief 计算 _now 之后第一个需要处理的 tick，不超过 limit
+     * \n - 第 0 层：下一个非空槽位到期的 tick
+     * \n - 第 i 层：下一个非空槽位级联的 tick，即第 i 层指针走到该槽位、低 8*i 位全为 0 的时刻
+     * \n - 溢出堆：堆顶定时器进入时间轮范围的 tick
+     */
+    uint64_t nextEvent(uint64_t limit)
+    {
+        uint64_t next = limit;
+        uint64_t offset = findOccupied(0, (_now + 1) & kSlotMask);
+        if (offset < kSlots && _now + 1 + offset < next)
+        {
+            next = _now + 1 + offset;
+        }
+        for (size_t level = 1; level < Levels; ++level)
+        {
+            size_t shift = kSlotBits * level;
+            uint64_t base = _now >> shift;
+            offset = findOccupied(level, (base + 1) & kSlotMask);
+            if (offset == kSlots || base + 1 + offset > (UINT64_MAX >> shift))
+            {
+                continue;
+            }
+            uint64_t at = (base + 1 + offset) << shift;
+            if (at < next)
+            {
+                next = at;
+            }
+        }
+        if (skipCancelled())
+        {
+            uint64_t enter = _overflow.top().expire - kHorizon + 1;
+            if (enter > _now && enter < next)
+            {
+                next = enter;
+            }
+        }
+        return next;
+    }
+
+    /**
+     * @brief 弹出堆顶已取消的条目
+     * @return 堆中还有有效条目时返回 true
+     */
+    bool skipCancelled()
+    {
+        while (!_overflow.empty())
+        {
+            const overflowEntry &e = _overflow.top();
+            if (_nodes[e.index].gen == e.gen && _nodes[e.index].state == kOverflow)
+            {
+                return true;
+            }
+            _overflow.removeTop();
+        }
+        return false;
+    }
+
+    /**
+     * @brief 推进一个 tick：迁移进入范围的溢出定时器，级联高层槽位，然后触发第 0 层当前槽位
+     */
+    void tick()
+    {
+        ++_now;
+        while (skipCancelled() && _overflow.top().expire - _now < kHorizon)
+        {
+            uint32_t index = _overflow.top().index;
+            _overflow.removeTop();
+            link(index);
+        }
+        for (size_t level = 1; level < Levels; ++level)
+        {
+            if ((_now & ((1ULL << (kSlotBits * level)) - 1)) != 0)
+            {
+                break;
+            }
+            cascade(level, (_now >> (kSlotBits * level)) & kSlotMask);
+        }
+        uint32_t slot = static_cast<uint32_t>(_now & kSlotMask);
+        uint32_t cur = _slots[slot];
+        _slots[slot] = kNil;
+        clearOccupied(slot);
+        while (cur != kNil)
+        {
+            uint32_t next = _nodes[cur].next;
+            --_size;
+            _expired.push_back(std::move(_nodes[cur].payload));
+            freeNode(cur);
+            cur = next;
+        }
+    }
+
+    uint64_t _resolution;                      ///< 每个 tick 对应的时间单位数
+    uint64_t _now = 0;                         ///< 当前 tick
+    size_t _size = 0;                          ///< 有效定时器数量
+    uint32_t _freeHead = kNil;                 ///< 空闲节点链表头
+    vector<node> _nodes;                       ///< 节点池
+    vector<uint32_t> _slots;                   ///< 各层槽位链表头
+    vector<uint64_t> _occupied;                ///< 各层槽位的占用位图，第 slot 位对应 _slots[slot]
+    vector<T> _expired;                        ///< 本次推进中到期的数据，复用内存
+    priorityQueueWarpper<overflowEntry> _overflow; ///< 超出时间轮范围的定时器
+};
@@ -1,6 +1,9 @@
+#pragma once
 #include <iostream>
+#include <memory>
 #include <vector>
 #include <stdexcept>
+#include <type_traits>
 
 using std::forward;
 using std::size_t;
@@ -16,17 +19,29 @@ using std::vector;
  * \n 修改元素不支持直接修改，需要先获取引用再修改
  * \n clear释放内存不会真的释放内存， shrink_to_fit可能释放，取决于编译器的实现。gcc会把容量缩减到和当前元素的数量相匹配
  * \n resize会截断当前vector，如果小于当前vector的size;反之会重新分配内存。resize
+ * \n std::vector 直接作为成员保存，构造封装类本身不申请内存；移动构造和移动赋值只交换三个指针，不会抛出异常
+ * \n 分配器在移动赋值时既不传播也不总是相等时，移动赋值可能需要逐个元素移动并申请内存，此时移动赋值不是 noexcept
+ * \n 可以通过 Alloc 指定分配器，例如使用 trackingAllocator 统计该容器的内存申请
+ * @tparam T 元素类型
+ * @tparam Alloc 分配器类型
  */
-template <typename T>
+template <typename T, typename Alloc = std::allocator<T>>
 class vectorWarpper
 {
 public:
     /**
      * @brief 无参构造函数。
      *
-     * 将 _vec 初始化为 nullptr，表示未分配内存。
+     * _vec 为空的 std::vector，不分配内存。
      */
-    vectorWarpper() : _vec(new std::vector<T>()) {}
+    vectorWarpper() = default;
+
+    /**
+     * @brief 指定分配器的构造函数。
+     *
+     * @param alloc 分配器
+     */
+    explicit vectorWarpper(const Alloc &alloc) : _vec(alloc) {}
 
     /**
      * @brief 参数化构造函数。
@@ -34,11 +49,9 @@ public:
      * 初始化 _vec 为一个指定大小的 std::vector。
      *
      * @param size vector 的长度，必须为非零正数。
+     * @param alloc 分配器
      */
-    explicit vectorWarpper(size_t size)
-    {
-        _vec = new std::vector<T>(size);
-    }
+    explicit vectorWarpper(size_t size, const Alloc &alloc = Alloc()) : _vec(size, alloc) {}
 
     /**
      * @brief 禁止拷贝构造函数。
@@ -46,9 +59,11 @@ public:
     vectorWarpper(const vectorWarpper &) = delete;
 
     /**
-     * @brief 禁止移动拷贝构造函数。
+     * @brief 移动构造函数。
+     *
+     * 接管 other 的内存，other 变为空。
      */
-    vectorWarpper(vectorWarpper &&) = delete;
+    vectorWarpper(vectorWarpper &&) noexcept(std::is_nothrow_move_constructible_v<std::vector<T, Alloc>>) = default;
 
     /**
      * @brief 禁止赋值运算符。
@@ -56,36 +71,33 @@ public:
     vectorWarpper &operator=(const vectorWarpper &) = delete;
 
     /**
-     * @brief 禁止赋值运算符。
+     * @brief 移动赋值运算符。
+     *
+     * 释放当前内存并接管 other 的内存，other 变为空。
      */
-    vectorWarpper &operator=(vectorWarpper &&) = delete;
+    vectorWarpper &operator=(vectorWarpper &&) noexcept(std::is_nothrow_move_assignable_v<std::vector<T, Alloc>>) = default;
 
     /**
      * @brief 析构函数。
-     *
-     * 释放动态分配的 std::vector 对象。
      */
-    ~vectorWarpper()
-    {
-        delete _vec; ///< 释放动态分配的 std::vector 对象
-    }
+    ~vectorWarpper() = default;
 
     /**
      * @brief 获取开始位置迭代器
      * @return 迭代器
      */
-    typename vector<T>::iterator begin()
+    typename vector<T, Alloc>::iterator begin()
     {
-        return _vec->begin();
+        return _vec.begin();
     }
 
     /**
      * @brief 获取结束位置迭代器
      * @return 迭代器
      */
-    typename vector<T>::iterator end()
+    typename vector<T, Alloc>::iterator end()
     {
-        return _vec->end();
+        return _vec.end();
     }
 
     /**
@@ -97,7 +109,7 @@ public:
      */
     int push_back(T &&t)
     {
-        _vec->push_back(forward<T>(t));
+        _vec.push_back(forward<T>(t));
         return 0;
     }
 
@@ -110,7 +122,7 @@ public:
      */
     int emplace_back(T &&t)
     {
-        _vec->emplace_back(forward<T>(t));
+        _vec.emplace_back(forward<T>(t));
         return 0;
     }
 
@@ -124,7 +136,7 @@ public:
      */
     int insert(const size_t &index, T &&t)
     {
-        _vec->insert(_vec->begin() + index, t);
+        _vec.insert(_vec.begin() + index, t);
         return 0;
     }
 
@@ -133,12 +145,12 @@ public:
      *  vector首先会检查空间是否足够如果足够那么就会直接插入，不够会让内存翻倍再插入。
      *  插入元素位置之后的所有元素都往后平移1位
      *  @param index 插入元素的索引
-     *  @param other vectorWarpper<T>
+     *  @param other vectorWarpper<T, Alloc>
      *  @return 成功会返回0
      */
-    int insert(const size_t &index, vectorWarpper<T> &other)
+    int insert(const size_t &index, vectorWarpper<T, Alloc> &other)
     {
-        _vec->insert(_vec->begin() + index, other.begin(), other.end());
+        _vec.insert(_vec.begin() + index, other.begin(), other.end());
         return 0;
     }
 
@@ -151,11 +163,11 @@ public:
      */
     int erase(const size_t begin_index, const size_t end_index)
     {
-        if (begin_index >= _vec->size() || end_index > _vec->size() || begin_index > end_index)
+        if (begin_index >= _vec.size() || end_index > _vec.size() || begin_index > end_index)
         {
             throw std::out_of_range("Index out of range");
         }
-        _vec->erase(_vec->begin() + begin_index, _vec->begin() + end_index);
+        _vec.erase(_vec.begin() + begin_index, _vec.begin() + end_index);
         return 0;
     }
 
@@ -169,7 +181,7 @@ public:
      */
     int resize(size_t size)
     {
-        _vec->resize(size);
+        _vec.resize(size);
         return 0;
     }
 
@@ -183,7 +195,7 @@ public:
      */
     int reserve(size_t capacity)
     {
-        _vec->reserve(capacity);
+        _vec.reserve(capacity);
         return 0;
     }
 
@@ -195,7 +207,7 @@ public:
     T &operator[](const size_t index)
     {
 
-        return (*_vec)[index];
+        return _vec[index];
     }
 
     /**
@@ -204,7 +216,7 @@ public:
      */
     size_t capacity()
     {
-        return _vec->capacity();
+        return _vec.capacity();
     }
 
     /**
@@ -213,9 +225,9 @@ public:
      */
     size_t size()
     {
-        return _vec->size();
+        return _vec.size();
     }
 
 private:
-    std::vector<T> *_vec; ///< 私有成员变量，指向动态分配的 std::vector 对象
+    std::vector<T, Alloc> _vec; ///< 私有成员变量，被封装的 std::vector 对象
 };
\ No newline at end of file
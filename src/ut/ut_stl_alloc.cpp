@@ -0,0 +1,220 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <type_traits>
+#include "../stl_alloc_stats.cpp"
+#include "../stl_vector.cpp"
+#include "../stl_list.cpp"
+#include "../stl_map.cpp"
+#include "../stl_priority.cpp"
+
+/**
+ * @brief 测试 vectorWarpper 的申请次数、存活字节和峰值
+ */
+TEST(AllocStatsTest, VectorWarpper)
+{
+    allocStats stats("vector");
+    {
+        vectorWarpper<int, trackingAllocator<int>> vw{trackingAllocator<int>(&stats)};
+        EXPECT_EQ(stats.snapshot().allocations, 0);
+        vw.reserve(100);
+        auto snap = stats.snapshot();
+        EXPECT_EQ(snap.allocations, 1);
+        EXPECT_EQ(snap.bytesLive, 100 * sizeof(int));
+        vw.reserve(200);
+        snap = stats.snapshot();
+        EXPECT_EQ(snap.allocations, 2);
+        EXPECT_EQ(snap.deallocations, 1);
+        EXPECT_EQ(snap.bytesLive, 200 * sizeof(int));
+        EXPECT_EQ(snap.bytesPeak, 300 * sizeof(int));
+    }
+    auto snap = stats.snapshot();
+    EXPECT_EQ(snap.bytesLive, 0);
+    EXPECT_EQ(snap.deallocations, 2);
+    EXPECT_EQ(snap.bytesTotal, 300 * sizeof(int));
+}
+
+/**
+ * @brief 测试 list 节点和 unordered_map 桶、节点的申请都被统计
+ */
+TEST(AllocStatsTest, NodeContainers)
+{
+    allocStats stats("nodes");
+    {
+        listWarpper<int, trackingAllocator<int>> lw{trackingAllocator<int>(&stats)};
+        lw.push_back(1);
+        lw.push_back(2);
+        lw.push_front(0);
+        EXPECT_EQ(stats.snapshot().allocations, 3);
+        lw.pop_back();
+        EXPECT_EQ(stats.snapshot().deallocations, 1);
+    }
+    EXPECT_EQ(stats.snapshot().bytesLive, 0);
+
+    allocStats mapStats("map");
+    {
+        using alloc = trackingAllocator<std::pair<const int, std::string>>;
+        unorderedMapWarpper<int, std::string, alloc> mw{alloc(&mapStats)};
+        for (int i = 0; i < 100; ++i)
+        {
+            mw[i] = "v";
+        }
+        EXPECT_GT(mapStats.snapshot().allocations, 100);
+    }
+    EXPECT_EQ(mapStats.snapshot().bytesLive, 0);
+}
+
+/**
+ * @brief 测试以分配器构造的 priorityQueueWarpper
+ */
+TEST(AllocStatsTest, PriorityQueueWarpper)
+{
+    allocStats stats("pq");
+    using queue = priority_queue<int, std::vector<int, trackingAllocator<int>>>;
+    priorityQueueWarpper<int, queue> pq{trackingAllocator<int>(&stats)};
+    pq.insert(1);
+    pq.insert(2);
+    EXPECT_EQ(pq.top(), 2);
+    EXPECT_GT(stats.snapshot().bytesLive, 0);
+}
+
+/**
+ * @brief 测试实例统计汇总到标签，并且移动后的容器继续记到原来的统计对象
+ */
+TEST(AllocStatsTest, InstanceRollsUpToTag)
+{
+    allocStats &tag = allocRegistry::instance().tag("ut-cache");
+    allocStats a("cache-a", &tag);
+    allocStats b("cache-b", &tag);
+    {
+        vectorWarpper<int, trackingAllocator<int>> va{trackingAllocator<int>(&a)};
+        vectorWarpper<int, trackingAllocator<int>> vb{trackingAllocator<int>(&b)};
+        va.reserve(10);
+        vb.reserve(30);
+        EXPECT_EQ(a.snapshot().bytesLive, 10 * sizeof(int));
+        EXPECT_EQ(b.snapshot().bytesLive, 30 * sizeof(int));
+        EXPECT_EQ(tag.snapshot().bytesLive, 40 * sizeof(int));
+
+        vb = std::move(va);
+        EXPECT_EQ(b.snapshot().bytesLive, 0);
+        EXPECT_EQ(a.snapshot().bytesLive, 10 * sizeof(int));
+    }
+    EXPECT_EQ(tag.snapshot().bytesLive, 0);
+    EXPECT_EQ(tag.snapshot().allocations, 2);
+    EXPECT_EQ(&allocRegistry::instance().tag("ut-cache"), &tag);
+}
+
+/**
+ * @brief 测试申请大小直方图
+ */
+TEST(AllocStatsTest, SizeClasses)
+{
+    EXPECT_EQ(allocStats::sizeClass(0), 0);
+    EXPECT_EQ(allocStats::sizeClass(1), 0);
+    EXPECT_EQ(allocStats::sizeClass(2), 1);
+    EXPECT_EQ(allocStats::sizeClass(16), 4);
+    EXPECT_EQ(allocStats::sizeClass(17), 5);
+    EXPECT_EQ(allocStats::sizeClass(size_t(1) << 40), allocSnapshot::kSizeClasses - 1);
+
+    allocStats stats;
+    stats.recordAllocate(16);
+    stats.recordAllocate(16);
+    stats.recordAllocate(1000);
+    auto snap = stats.snapshot();
+    EXPECT_EQ(snap.sizeClasses[4], 2);
+    EXPECT_EQ(snap.sizeClasses[10], 1);
+}
+
+/**
+ * @brief 测试注册表快照导出为 JSON
+ */
+TEST(AllocStatsTest, RegistryJson)
+{
+    allocStats &tag = allocRegistry::instance().tag("ut-json");
+    tag.recordAllocate(64);
+    std::string json = allocRegistry::instance().toJson();
+    EXPECT_EQ(json.front(), '[');
+    EXPECT_EQ(json.back(), ']');
+    EXPECT_NE(json.find("{\"name\":\"ut-json\",\"allocations\":1,\"deallocations\":0,\"bytes_total\":64,\"bytes_live\":64,\"bytes_peak\":64"), std::string::npos);
+    tag.recordDeallocate(64);
+}
+
+/**
+ * @brief 测试名字中的引号、反斜杠和控制字符会被转义
+ */
+TEST(AllocStatsTest, JsonEscapesName)
+{
+    allocSnapshot snap;
+    snap.name = std::string("a\"b\\c\nd\te\x01" "f\x1f");
+    std::string json = snap.toJson();
+    EXPECT_EQ(json.rfind(R"({"name":"a\"b\\c\nd\te\u0001f\u001f","allocations":0)", 0), 0);
+
+    allocStats &tag = allocRegistry::instance().tag("ut \"quoted\"");
+    tag.recordAllocate(8);
+    EXPECT_NE(allocRegistry::instance().toJson().find(R"({"name":"ut \"quoted\"","allocations":1)"), std::string::npos);
+    tag.recordDeallocate(8);
+}
+
+/**
+ * @brief 移动赋值时不传播、也不总是相等的分配器，移动赋值可能需要申请内存
+ */
+template <typename T>
+struct pinnedAllocator
+{
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::false_type;
+    using is_always_equal = std::false_type;
+
+    explicit pinnedAllocator(int id) noexcept : id(id) {}
+
+    template <typename U>
+    pinnedAllocator(const pinnedAllocator<U> &other) noexcept : id(other.id) {}
+
+    T *allocate(size_t n)
+    {
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T *p, size_t n) noexcept
+    {
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    template <typename U>
+    bool operator==(const pinnedAllocator<U> &other) const noexcept
+    {
+        return id == other.id;
+    }
+
+    int id;
+};
+
+/**
+ * @brief 测试封装类移动操作的 noexcept 与底层容器一致
+ */
+TEST(AllocStatsTest, MoveNoexceptFollowsAllocator)
+{
+    EXPECT_TRUE((std::is_nothrow_move_assignable_v<vectorWarpper<int, trackingAllocator<int>>>));
+    EXPECT_TRUE((std::is_nothrow_move_assignable_v<listWarpper<int, trackingAllocator<int>>>));
+    EXPECT_TRUE((std::is_nothrow_move_assignable_v<unorderedMapWarpper<int, int, trackingAllocator<std::pair<const int, int>>>>));
+
+    EXPECT_TRUE((std::is_nothrow_move_constructible_v<vectorWarpper<int, pinnedAllocator<int>>>));
+    EXPECT_FALSE((std::is_nothrow_move_assignable_v<vectorWarpper<int, pinnedAllocator<int>>>));
+    EXPECT_FALSE((std::is_nothrow_move_assignable_v<listWarpper<int, pinnedAllocator<int>>>));
+    EXPECT_FALSE((std::is_nothrow_move_assignable_v<unorderedMapWarpper<int, int, pinnedAllocator<std::pair<const int, int>>>>));
+    EXPECT_FALSE((std::is_nothrow_move_assignable_v<priorityQueueWarpper<int, priority_queue<int, vector<int, pinnedAllocator<int>>>>>));
+
+    // 分配器不相等时逐个元素移动，结果仍然正确
+    vectorWarpper<int, pinnedAllocator<int>> a{pinnedAllocator<int>(1)};
+    vectorWarpper<int, pinnedAllocator<int>> b{pinnedAllocator<int>(2)};
+    a.push_back(1);
+    a.push_back(2);
+    b = std::move(a);
+    EXPECT_EQ(b.size(), 2);
+    EXPECT_EQ(b[1], 2);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
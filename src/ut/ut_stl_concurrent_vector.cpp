@@ -0,0 +1,242 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../stl_concurrent_vector.cpp"
+
+/**
+ * @brief 测试单线程下 push_back、emplace_back 和 operator[]
+ */
+TEST(ConcurrentVectorTest, PushBack)
+{
+    concurrentVector<std::string> cv;
+    EXPECT_EQ(cv.push_back("a"), 0);
+    std::string b = "b";
+    EXPECT_EQ(cv.push_back(b), 1);
+    EXPECT_EQ(cv.emplace_back(3, 'c'), 2);
+    EXPECT_EQ(cv.size(), 3);
+    EXPECT_EQ(cv[0], "a");
+    EXPECT_EQ(cv[1], "b");
+    EXPECT_EQ(cv[2], "ccc");
+    EXPECT_THROW(cv.at(3), std::out_of_range);
+}
+
+/**
+ * @brief 测试跨越多个段时元素地址保持不变
+ */
+TEST(ConcurrentVectorTest, SegmentsNeverRelocate)
+{
+    concurrentVector<int> cv;
+    cv.push_back(42);
+    int *first = &cv[0];
+    for (int i = 1; i < 100000; ++i)
+    {
+        cv.push_back(i);
+    }
+    EXPECT_EQ(first, &cv[0]);
+    EXPECT_EQ(*first, 42);
+    for (int i = 1; i < 100000; ++i)
+    {
+        ASSERT_EQ(cv[i], i);
+    }
+    int count = 0;
+    for (int v : cv)
+    {
+        (void)v;
+        ++count;
+    }
+    EXPECT_EQ(count, 100000);
+}
+
+/**
+ * @brief 测试 reserve 分配段但不改变 size
+ */
+TEST(ConcurrentVectorTest, Reserve)
+{
+    concurrentVector<int> cv;
+    EXPECT_EQ(cv.capacity(), 0);
+    cv.reserve(1000);
+    EXPECT_GE(cv.capacity(), 1000);
+    EXPECT_EQ(cv.size(), 0);
+}
+
+/**
+ * @brief 测试 grow_by 领取连续下标
+ */
+TEST(ConcurrentVectorTest, GrowBy)
+{
+    concurrentVector<int> cv;
+    cv.push_back(1);
+    EXPECT_EQ(cv.grow_by(1000, 7), 1);
+    EXPECT_EQ(cv.size(), 1001);
+    EXPECT_EQ(cv[1], 7);
+    EXPECT_EQ(cv[1000], 7);
+    EXPECT_EQ(cv.grow_by(2), 1001);
+    EXPECT_EQ(cv[1002], 0);
+}
+
+/**
+ * @brief 测试超出容量上限：抛出 std::length_error，不领取下标
+ */
+TEST(ConcurrentVectorTest, TooLarge)
+{
+    using cv = concurrentVector<int>;
+    cv v;
+    v.push_back(1);
+    EXPECT_THROW(v.grow_by(cv::kMaxSize), std::length_error);
+    EXPECT_THROW(v.grow_by(SIZE_MAX), std::length_error);
+    EXPECT_THROW(v.reserve(cv::kMaxSize + 1), std::length_error);
+    EXPECT_EQ(v.size(), 1);
+    v.push_back(2);
+    EXPECT_EQ(v[1], 2);
+}
+
+/**
+ * @brief 构造可能抛出异常的元素：用负数构造时抛出，拷贝值为 13 的对象时抛出；移动不抛出异常
+ */
+struct flaky
+{
+    static inline int live = 0;
+    int v = 0;
+    flaky() noexcept { ++live; }
+    flaky(int v) : v(v)
+    {
+        if (v < 0)
+        {
+            throw std::runtime_error("flaky");
+        }
+        ++live;
+    }
+    flaky(const flaky &o) : v(o.v)
+    {
+        if (v == 13)
+        {
+            throw std::runtime_error("flaky copy");
+        }
+        ++live;
+    }
+    flaky(flaky &&o) noexcept : v(o.v) { ++live; }
+    ~flaky() { --live; }
+};
+
+/**
+ * @brief 测试元素构造抛出异常：emplace_back/push_back 不领取下标，grow_by 用默认值填充剩余位置
+ */
+TEST(ConcurrentVectorTest, ThrowingConstructor)
+{
+    {
+        concurrentVector<flaky> cv;
+        cv.emplace_back(1);
+        EXPECT_THROW(cv.emplace_back(-1), std::runtime_error);
+        EXPECT_EQ(cv.size(), 1);
+
+        const flaky poison(13);
+        EXPECT_THROW(cv.push_back(poison), std::runtime_error);
+        EXPECT_EQ(cv.size(), 1);
+
+        const flaky seven(7);
+        cv.push_back(seven);
+        EXPECT_EQ(cv[1].v, 7);
+
+        EXPECT_THROW(cv.grow_by(3, poison), std::runtime_error);
+        EXPECT_EQ(cv.size(), 5);
+        EXPECT_EQ(cv[2].v, 0);
+        EXPECT_EQ(cv[4].v, 0);
+        EXPECT_EQ(flaky::live, 7); // 5 个元素加上 poison 和 seven
+    }
+    EXPECT_EQ(flaky::live, 0);
+}
+
+/**
+ * @brief 测试元素在析构时被销毁
+ */
+TEST(ConcurrentVectorTest, DestroysElements)
+{
+    auto tracker = std::make_shared<int>(0);
+    {
+        concurrentVector<std::shared_ptr<int>> cv;
+        for (int i = 0; i < 1000; ++i)
+        {
+            cv.push_back(tracker);
+        }
+        EXPECT_EQ(tracker.use_count(), 1001);
+    }
+    EXPECT_EQ(tracker.use_count(), 1);
+}
+
+/**
+ * @brief 压力测试：多个线程同时 push_back 和 grow_by，读线程并发读取已发布的下标
+ */
+TEST(ConcurrentVectorTest, Stress)
+{
+    constexpr uint64_t kThreads = 8;
+    constexpr uint64_t kPerThread = 50000;
+    concurrentVector<uint64_t> cv;
+    std::array<std::atomic<size_t>, kThreads> published{};
+    std::atomic<bool> done{false};
+    std::atomic<uint64_t> badReads{0};
+
+    std::thread reader([&]
+                       {
+        while (!done.load(std::memory_order_acquire))
+        {
+            for (uint64_t t = 0; t < kThreads; ++t)
+            {
+                size_t idx = published[t].load(std::memory_order_acquire);
+                if (idx != 0 && cv[idx - 1] >> 32 != t)
+                {
+                    badReads.fetch_add(1);
+                }
+            }
+        } });
+
+    std::vector<std::thread> writers;
+    for (uint64_t t = 0; t < kThreads; ++t)
+    {
+        writers.emplace_back([&, t]
+                             {
+            for (uint64_t i = 0; i < kPerThread; ++i)
+            {
+                size_t idx;
+                if (i % 100 == 99)
+                {
+                    // 用 grow_by 领取 1 个下标，检验批量和单个追加可以混用
+                    idx = cv.grow_by(1, (t << 32) | i);
+                }
+                else
+                {
+                    idx = cv.push_back((t << 32) | i);
+                }
+                published[t].store(idx + 1, std::memory_order_release);
+            } });
+    }
+    for (auto &w : writers)
+    {
+        w.join();
+    }
+    done.store(true, std::memory_order_release);
+    reader.join();
+
+    EXPECT_EQ(badReads.load(), 0);
+    ASSERT_EQ(cv.size(), kThreads * kPerThread);
+    std::vector<uint64_t> all(cv.begin(), cv.end());
+    std::sort(all.begin(), all.end());
+    for (uint64_t t = 0; t < kThreads; ++t)
+    {
+        for (uint64_t i = 0; i < kPerThread; ++i)
+        {
+            ASSERT_EQ(all[t * kPerThread + i], (t << 32) | i);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
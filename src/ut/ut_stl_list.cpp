@@ -125,6 +125,29 @@ TEST_F(ListWarpperTest, PopFrontAndPopBack)
     EXPECT_EQ(*it, 3);
 }
 
+/**
+ * @brief 测试移动构造和移动赋值转移节点，且不抛出异常
+ */
+TEST_F(ListWarpperTest, Move)
+{
+    EXPECT_TRUE(std::is_nothrow_move_constructible<listWarpper<int>>::value);
+    EXPECT_TRUE(std::is_nothrow_move_assignable<listWarpper<int>>::value);
+
+    listWrapper->push_back(1);
+    listWrapper->push_back(2);
+
+    listWarpper<int> moved(std::move(*listWrapper));
+    EXPECT_EQ(*moved.begin(), 1);
+
+    listWarpper<int> assigned;
+    assigned.push_back(99);
+    assigned = std::move(moved);
+    auto it = assigned.begin();
+    EXPECT_EQ(*it, 1);
+    std::advance(it, 1);
+    EXPECT_EQ(*it, 2);
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,307 @@
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <iterator>
+#include <new>
+#include <random>
+#include <type_traits>
+#include "../stl_packed_vector.cpp"
+
+using encoding = packedVector<uint64_t>::encoding;
+
+/**
+ * @brief 第 failAfter 次（从 0 开始）申请内存时抛出 std::bad_alloc，负数表示不失败
+ */
+static int failAfter = -1;
+
+void *operator new(size_t size)
+{
+    if (failAfter == 0)
+    {
+        failAfter = -1;
+        throw std::bad_alloc();
+    }
+    if (failAfter > 0)
+    {
+        --failAfter;
+    }
+    if (void *p = std::malloc(size ? size : 1))
+    {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void *p, size_t) noexcept
+{
+    std::free(p);
+}
+
+/**
+ * @brief 生成 n 个不超过 bits 位的随机数
+ */
+static vector<uint64_t> randomValues(size_t n, unsigned bits, uint64_t seed = 42)
+{
+    std::mt19937_64 rng(seed);
+    vector<uint64_t> values(n);
+    for (auto &v : values)
+    {
+        v = bits == 64 ? rng() : rng() & ((1ULL << bits) - 1);
+    }
+    return values;
+}
+
+/**
+ * @brief 检查 operator[]、decode 和迭代器的结果都与原始数据一致
+ */
+template <typename Int>
+static void expectSame(const packedVector<Int> &pv, const vector<Int> &values)
+{
+    ASSERT_EQ(pv.size(), values.size());
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        ASSERT_EQ(pv[i], values[i]) << "index " << i;
+    }
+    vector<Int> decoded(values.size());
+    EXPECT_EQ(pv.decode(0, values.size(), decoded.data()), values.size());
+    EXPECT_EQ(decoded, values);
+    vector<Int> iterated(pv.begin(), pv.end());
+    EXPECT_EQ(iterated, values);
+}
+
+/**
+ * @brief 测试 push_back 时位宽随数据增长
+ */
+TEST(PackedVectorTest, PushBackWidensBitWidth)
+{
+    packedVector<uint64_t> pv;
+    EXPECT_TRUE(pv.empty());
+    pv.push_back(0);
+    EXPECT_EQ(pv.bitWidth(), 0);
+    pv.push_back(5);
+    EXPECT_EQ(pv.bitWidth(), 3);
+    pv.push_back(1 << 20);
+    EXPECT_EQ(pv.bitWidth(), 21);
+    EXPECT_EQ(pv[0], 0);
+    EXPECT_EQ(pv[1], 5);
+    EXPECT_EQ(pv[2], 1 << 20);
+    EXPECT_EQ(pv.size(), 3);
+}
+
+/**
+ * @brief 测试从数据构造时一次确定位宽，并覆盖 0~64 的所有位宽
+ */
+TEST(PackedVectorTest, FixedAllWidths)
+{
+    for (unsigned bits = 0; bits <= 64; ++bits)
+    {
+        auto values = randomValues(1000, bits, bits);
+        if (bits > 0)
+        {
+            values[7] = bits == 64 ? ~0ULL : (1ULL << bits) - 1;
+        }
+        packedVector<uint64_t> pv(values.begin(), values.end());
+        EXPECT_EQ(pv.bitWidth(), bits);
+        expectSame(pv, values);
+    }
+}
+
+/**
+ * @brief 测试 28 位的数据压缩率
+ */
+TEST(PackedVectorTest, CompressionRatio)
+{
+    auto values = randomValues(64 * 1000, 28);
+    packedVector<uint64_t> pv(values.begin(), values.end());
+    EXPECT_EQ(pv.bytes(), values.size() * 28 / 8);
+}
+
+/**
+ * @brief 测试 frameOfReference 编码，包括不满一块的尾部
+ */
+TEST(PackedVectorTest, FrameOfReference)
+{
+    auto values = randomValues(1000, 12);
+    for (auto &v : values)
+    {
+        v += 1ULL << 40;
+    }
+    packedVector<uint64_t> pv(values.begin(), values.end(), encoding::frameOfReference);
+    expectSame(pv, values);
+    EXPECT_LT(pv.bytes(), values.size() * 3);
+}
+
+/**
+ * @brief 测试 delta 编码：有序数据压缩率高，无序数据和回绕也能正确还原
+ */
+TEST(PackedVectorTest, Delta)
+{
+    vector<uint64_t> sorted;
+    uint64_t offset = 1ULL << 50;
+    for (auto d : randomValues(1000, 6))
+    {
+        offset += d;
+        sorted.push_back(offset);
+    }
+    packedVector<uint64_t> pv(sorted.begin(), sorted.end(), encoding::delta);
+    expectSame(pv, sorted);
+    EXPECT_LT(pv.bytes(), sorted.size() * 2);
+
+    auto unsorted = randomValues(1000, 64);
+    packedVector<uint64_t> pv2(unsorted.begin(), unsorted.end(), encoding::delta);
+    expectSame(pv2, unsorted);
+}
+
+/**
+ * @brief 测试 Int 比 64 位窄时 delta 的 zigzag 差值多出一位
+ */
+TEST(PackedVectorTest, NarrowIntDelta)
+{
+    vector<uint32_t> values;
+    for (auto v : randomValues(500, 32))
+    {
+        values.push_back(static_cast<uint32_t>(v));
+    }
+    values[3] = 0;
+    values[4] = UINT32_MAX;
+    values[5] = 0;
+    packedVector<uint32_t> pv(values.begin(), values.end(), packedVector<uint32_t>::encoding::delta);
+    expectSame(pv, values);
+}
+
+/**
+ * @brief 测试从任意位置开始的 decode
+ */
+TEST(PackedVectorTest, DecodeRange)
+{
+    auto values = randomValues(1000, 20);
+    for (auto enc : {encoding::fixed, encoding::frameOfReference, encoding::delta})
+    {
+        packedVector<uint64_t> pv(values.begin(), values.end(), enc);
+        vector<uint64_t> out(300);
+        EXPECT_EQ(pv.decode(37, 300, out.data()), 300);
+        EXPECT_TRUE(std::equal(out.begin(), out.end(), values.begin() + 37));
+        EXPECT_EQ(pv.decode(900, 300, out.data()), 100);
+        EXPECT_TRUE(std::equal(out.begin(), out.begin() + 100, values.begin() + 900));
+        EXPECT_EQ(pv.decode(1000, 1, out.data()), 0);
+    }
+}
+
+/**
+ * @brief 测试 set 和 at
+ */
+TEST(PackedVectorTest, SetAndAt)
+{
+    packedVector<uint64_t> pv;
+    pv.push_back(1);
+    pv.push_back(2);
+    pv.set(0, 1000);
+    EXPECT_EQ(pv.at(0), 1000);
+    EXPECT_EQ(pv.at(1), 2);
+    EXPECT_THROW(pv.at(2), std::out_of_range);
+    EXPECT_THROW(pv.set(2, 1), std::out_of_range);
+
+    packedVector<uint64_t> delta(encoding::delta);
+    delta.push_back(1);
+    EXPECT_THROW(delta.set(0, 2), std::logic_error);
+}
+
+/**
+ * @brief 测试移动构造和移动赋值：不可拷贝，移动后原对象为空并且可以继续使用
+ */
+TEST(PackedVectorTest, Move)
+{
+    EXPECT_FALSE(std::is_copy_constructible<packedVector<uint64_t>>::value);
+    EXPECT_TRUE(std::is_nothrow_move_constructible<packedVector<uint64_t>>::value);
+    EXPECT_TRUE(std::is_nothrow_move_assignable<packedVector<uint64_t>>::value);
+
+    for (encoding enc : {encoding::fixed, encoding::frameOfReference, encoding::delta})
+    {
+        packedVector<uint64_t> pv(enc);
+        for (uint64_t i = 0; i < 300; ++i)
+        {
+            pv.push_back(i * 3);
+        }
+        packedVector<uint64_t> moved(std::move(pv));
+        EXPECT_EQ(moved.size(), 300);
+        EXPECT_EQ(moved.at(299), 897);
+        EXPECT_EQ(pv.size(), 0);
+        EXPECT_TRUE(pv.begin() == pv.end());
+        EXPECT_THROW(pv.at(0), std::out_of_range);
+        pv.push_back(7);
+        EXPECT_EQ(pv.at(0), 7);
+
+        packedVector<uint64_t> assigned(enc);
+        assigned = std::move(moved);
+        EXPECT_EQ(assigned.size(), 300);
+        EXPECT_EQ(assigned.at(150), 450);
+        EXPECT_EQ(moved.size(), 0);
+        EXPECT_TRUE(moved.begin() == moved.end());
+    }
+}
+
+/**
+ * @brief 测试迭代器：按值返回，*it++ 返回递增前的值，拷贝共享缓冲区
+ */
+TEST(PackedVectorTest, Iterator)
+{
+    using iter = packedVector<uint64_t>::const_iterator;
+    static_assert(std::input_iterator<iter>);
+    static_assert(std::is_same_v<std::iter_reference_t<iter>, uint64_t>);
+    EXPECT_LE(sizeof(iter), 48);
+
+    packedVector<uint64_t> pv;
+    for (uint64_t i = 0; i < 300; ++i)
+    {
+        pv.push_back(i);
+    }
+    auto it = pv.begin();
+    for (uint64_t i = 0; i < 300; ++i)
+    {
+        // 跨越块边界时 *it++ 仍然返回旧值
+        EXPECT_EQ(*it++, i);
+    }
+    EXPECT_TRUE(it == pv.end());
+}
+
+/**
+ * @brief 测试分块模式下压缩一块时申请内存失败：撤销本次插入，之后的插入和解码不受影响
+ */
+TEST(PackedVectorTest, SealBlockFailure)
+{
+    for (encoding enc : {encoding::frameOfReference, encoding::delta})
+    {
+        for (int fail : {0, 1}) // 0: _words 扩容失败，1: _blocks 扩容失败
+        {
+            packedVector<uint64_t> pv(enc);
+            for (uint64_t i = 0; i < packedVector<uint64_t>::kBlock - 1; ++i)
+            {
+                pv.push_back(i * 3);
+            }
+            failAfter = fail;
+            EXPECT_THROW(pv.push_back(381), std::bad_alloc);
+            failAfter = -1;
+            EXPECT_EQ(pv.size(), packedVector<uint64_t>::kBlock - 1);
+
+            for (uint64_t i = packedVector<uint64_t>::kBlock - 1; i < 300; ++i)
+            {
+                pv.push_back(i * 3);
+            }
+            ASSERT_EQ(pv.size(), 300);
+            for (uint64_t i = 0; i < 300; ++i)
+            {
+                EXPECT_EQ(pv[i], i * 3);
+            }
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -1,4 +1,6 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
 #include <string>
 #include "../stl_priority.cpp"
 
@@ -87,3 +89,167 @@ TEST(PriorityQueueWrapperTest, StringType)
     // 字符串按字典序排序，"cherry" 应该在顶部
     EXPECT_EQ(pq.top(), "cherry");
 }
+
+/**
+ * @brief 测试移动构造和移动赋值转移元素，且不抛出异常
+ */
+TEST(PriorityQueueWrapperTest, Move)
+{
+    EXPECT_TRUE(std::is_nothrow_move_constructible<priorityQueueWarpper<int>>::value);
+    EXPECT_TRUE(std::is_nothrow_move_assignable<priorityQueueWarpper<int>>::value);
+
+    priorityQueueWarpper<int> pq;
+    pq.insert(10);
+    pq.insert(20);
+
+    priorityQueueWarpper<int> moved(std::move(pq));
+    EXPECT_EQ(moved.size(), 2);
+    EXPECT_EQ(moved.top(), 20);
+
+    priorityQueueWarpper<int> assigned;
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned.size(), 2);
+    EXPECT_EQ(assigned.top(), 20);
+
+    // radixHeap 底层容器：移动后原对象为空，可以继续使用
+    EXPECT_TRUE(std::is_nothrow_move_constructible<radixPriorityQueueWarpper<uint32_t>>::value);
+    EXPECT_TRUE(std::is_nothrow_move_assignable<radixPriorityQueueWarpper<uint32_t>>::value);
+    radixPriorityQueueWarpper<uint32_t> radix;
+    radix.insert(3);
+    radix.insert(1);
+    radix.insert(2);
+    EXPECT_EQ(radix.top(), 1);
+
+    radixPriorityQueueWarpper<uint32_t> radixMoved(std::move(radix));
+    EXPECT_EQ(radixMoved.size(), 3);
+    EXPECT_EQ(radixMoved.top(), 1);
+    EXPECT_TRUE(radix.empty());
+    EXPECT_EQ(radix.size(), 0);
+    radix.removeTop();
+    radix.insert(0);
+    EXPECT_EQ(radix.top(), 0);
+
+    radixPriorityQueueWarpper<uint32_t> radixAssigned;
+    radixAssigned = std::move(radixMoved);
+    EXPECT_EQ(radixAssigned.size(), 3);
+    radixAssigned.removeTop();
+    EXPECT_EQ(radixAssigned.top(), 2);
+    EXPECT_TRUE(radixMoved.empty());
+    radixMoved.removeTop();
+}
+
+/**
+ * @brief 测试 radixHeap 底层容器：top 返回最小元素
+ */
+TEST(RadixPriorityQueueTest, InsertAndTop)
+{
+    radixPriorityQueueWarpper<uint32_t> pq;
+    pq.insert(10);
+    pq.insert(5);
+    pq.insert(20);
+    pq.insert(5);
+
+    EXPECT_EQ(pq.size(), 4);
+    EXPECT_EQ(pq.top(), 5);
+    pq.removeTop();
+    EXPECT_EQ(pq.top(), 5);
+    pq.removeTop();
+    EXPECT_EQ(pq.top(), 10);
+    pq.removeTop();
+    EXPECT_EQ(pq.top(), 20);
+    pq.removeTop();
+    EXPECT_TRUE(pq.empty());
+
+    // 空队列 removeTop 不执行任何操作
+    pq.removeTop();
+    EXPECT_EQ(pq.size(), 0);
+}
+
+/**
+ * @brief 测试边插入边取出，插入的键不小于已取出的键
+ */
+TEST(RadixPriorityQueueTest, InterleavedMonotone)
+{
+    radixPriorityQueueWarpper<uint64_t> pq;
+    pq.insert(100);
+    EXPECT_EQ(pq.top(), 100);
+    pq.removeTop();
+    pq.insert(100);
+    pq.insert(UINT64_MAX);
+    pq.insert(150);
+    EXPECT_EQ(pq.top(), 100);
+    pq.removeTop();
+    pq.insert(120);
+    EXPECT_EQ(pq.top(), 120);
+    pq.removeTop();
+    EXPECT_EQ(pq.top(), 150);
+    pq.removeTop();
+    EXPECT_EQ(pq.top(), UINT64_MAX);
+}
+
+/**
+ * @brief 测试 (key, value) 元素按 key 排序
+ */
+TEST(RadixPriorityQueueTest, PairElement)
+{
+    radixPriorityQueueWarpper<std::pair<uint32_t, std::string>> pq;
+    pq.insert({3, "c"});
+    pq.insert({1, "a"});
+    pq.insert({2, "b"});
+
+    EXPECT_EQ(pq.top().second, "a");
+    pq.removeTop();
+    EXPECT_EQ(pq.top().second, "b");
+    pq.removeTop();
+    EXPECT_EQ(pq.top().second, "c");
+}
+
+/**
+ * @brief 随机单调序列与 std::priority_queue 小顶堆对比
+ */
+TEST(RadixPriorityQueueTest, RandomAgainstStd)
+{
+    radixPriorityQueueWarpper<uint32_t> pq;
+    std::priority_queue<uint32_t, std::vector<uint32_t>, std::greater<uint32_t>> ref;
+    std::mt19937 rng(42);
+    uint32_t last = 0;
+    for (int i = 0; i < 100000; ++i)
+    {
+        if (ref.empty() || rng() % 3 != 0)
+        {
+            uint32_t key = last + rng() % 1000;
+            pq.insert(key);
+            ref.push(key);
+        }
+        else
+        {
+            ASSERT_EQ(pq.top(), ref.top());
+            last = ref.top();
+            pq.removeTop();
+            ref.pop();
+        }
+        ASSERT_EQ(pq.size(), ref.size());
+    }
+}
+
+#ifndef NDEBUG
+/**
+ * @brief 测试调试构建下拒绝非单调插入
+ */
+TEST(RadixPriorityQueueTest, RejectNonMonotoneInsert)
+{
+    radixPriorityQueueWarpper<uint32_t> pq;
+    pq.insert(10);
+    pq.insert(20);
+    EXPECT_EQ(pq.top(), 10);
+    pq.removeTop();
+    EXPECT_THROW(pq.insert(5), std::invalid_argument);
+    EXPECT_EQ(pq.size(), 1);
+}
+#endif
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,288 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include "../stl_soa_vector.cpp"
+
+using record = soaVector<int, double, std::string>;
+
+/**
+ * @brief 测试 push_back 和行代理读写
+ */
+TEST(SoaVectorTest, PushBackAndRowProxy)
+{
+    record soa;
+    EXPECT_TRUE(soa.empty());
+    soa.push_back(1, 1.5, "a");
+    soa.emplace_back(2, 2.5, "b");
+    EXPECT_EQ(soa.size(), 2);
+
+    auto [id, score, name] = soa[1];
+    EXPECT_EQ(id, 2);
+    EXPECT_EQ(score, 2.5);
+    EXPECT_EQ(name, "b");
+
+    // 行代理是引用，修改会写回列中
+    name = "changed";
+    std::get<0>(soa[0]) = 10;
+    EXPECT_EQ(std::get<2>(soa[1]), "changed");
+    EXPECT_EQ(std::get<0>(soa[0]), 10);
+
+    const record &csoa = soa;
+    EXPECT_EQ(std::get<1>(csoa[0]), 1.5);
+}
+
+/**
+ * @brief 测试列视图连续、按 64 字节对齐，并且扩容后数据保持不变
+ */
+TEST(SoaVectorTest, ColumnSpan)
+{
+    soaVector<uint32_t, uint64_t, uint8_t> soa;
+    for (uint32_t i = 0; i < 1000; ++i)
+    {
+        soa.push_back(i, uint64_t(i) * 3, uint8_t(i));
+    }
+    EXPECT_GE(soa.capacity(), 1000);
+
+    auto ids = soa.column<0>();
+    auto values = soa.column<1>();
+    EXPECT_EQ(ids.size(), 1000);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(ids.data()) % 64, 0);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(values.data()) % 64, 0);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(soa.column<2>().data()) % 64, 0);
+    EXPECT_EQ(std::accumulate(ids.begin(), ids.end(), uint64_t(0)), 999 * 1000 / 2);
+    EXPECT_EQ(std::accumulate(values.begin(), values.end(), uint64_t(0)), 3ULL * 999 * 1000 / 2);
+
+    for (auto &v : soa.column<1>())
+    {
+        v = 7;
+    }
+    EXPECT_EQ(std::get<1>(soa[500]), 7);
+}
+
+/**
+ * @brief 测试 erase 删除若干行，以及越界异常
+ */
+TEST(SoaVectorTest, Erase)
+{
+    record soa;
+    for (int i = 0; i < 5; ++i)
+    {
+        soa.push_back(i, i * 0.5, std::to_string(i));
+    }
+    soa.erase(1, 3);
+    EXPECT_EQ(soa.size(), 3);
+    EXPECT_EQ(std::get<0>(soa[1]), 3);
+    EXPECT_EQ(std::get<2>(soa[1]), "3");
+    EXPECT_EQ(std::get<2>(soa[2]), "4");
+    EXPECT_THROW(soa.erase(2, 4), std::out_of_range);
+    EXPECT_THROW(soa.erase(2, 1), std::out_of_range);
+}
+
+/**
+ * @brief 测试 resize 扩大和缩小
+ */
+TEST(SoaVectorTest, Resize)
+{
+    record soa(3);
+    EXPECT_EQ(soa.size(), 3);
+    EXPECT_EQ(std::get<0>(soa[2]), 0);
+    EXPECT_EQ(std::get<2>(soa[2]), "");
+
+    soa.push_back(9, 9.0, "nine");
+    soa.resize(10);
+    EXPECT_EQ(soa.size(), 10);
+    EXPECT_EQ(std::get<2>(soa[3]), "nine");
+    EXPECT_EQ(std::get<2>(soa[9]), "");
+
+    soa.resize(2);
+    EXPECT_EQ(soa.size(), 2);
+    EXPECT_EQ(soa.column<2>().size(), 2);
+}
+
+/**
+ * @brief 测试 reserve 和 clear
+ */
+TEST(SoaVectorTest, ReserveAndClear)
+{
+    record soa;
+    soa.reserve(100);
+    EXPECT_EQ(soa.capacity(), 100);
+    soa.push_back(1, 1.0, "x");
+    soa.reserve(10);
+    EXPECT_EQ(soa.capacity(), 100);
+    soa.clear();
+    EXPECT_TRUE(soa.empty());
+    EXPECT_EQ(soa.capacity(), 100);
+}
+
+/**
+ * @brief 测试移动构造和移动赋值
+ */
+TEST(SoaVectorTest, Move)
+{
+    EXPECT_FALSE(std::is_copy_constructible<record>::value);
+    EXPECT_TRUE(std::is_nothrow_move_constructible<record>::value);
+    EXPECT_TRUE(std::is_nothrow_move_assignable<record>::value);
+
+    record a;
+    a.push_back(1, 1.0, "long string that does not fit in SSO");
+    record b(std::move(a));
+    EXPECT_EQ(b.size(), 1);
+    EXPECT_TRUE(a.empty());
+
+    record c(2);
+    c = std::move(b);
+    EXPECT_EQ(std::get<2>(c[0]), "long string that does not fit in SSO");
+}
+
+/**
+ * @brief 统计存活实例数量的字段，移动不会抛出异常
+ */
+struct tracked
+{
+    static inline int live = 0;
+    int v;
+    tracked(int v = 0) : v(v) { ++live; }
+    tracked(const tracked &o) : v(o.v) { ++live; }
+    tracked(tracked &&o) noexcept : v(o.v) { ++live; }
+    tracked &operator=(const tracked &) = default;
+    tracked &operator=(tracked &&) = default;
+    ~tracked() { --live; }
+};
+
+/**
+ * @brief 构造可能抛出异常的字段：用负数构造时抛出，拷贝次数用完后拷贝抛出；没有移动构造，扩容时只能拷贝
+ */
+struct thrower
+{
+    static inline int live = 0;
+    static inline int copiesLeft = -1; ///< 负数表示不限制
+    int v;
+    thrower(int v = 0) : v(v)
+    {
+        if (v < 0)
+        {
+            throw std::runtime_error("thrower");
+        }
+        ++live;
+    }
+    thrower(const thrower &o) : v(o.v)
+    {
+        if (copiesLeft == 0)
+        {
+            throw std::runtime_error("thrower copy");
+        }
+        if (copiesLeft > 0)
+        {
+            --copiesLeft;
+        }
+        ++live;
+    }
+    thrower &operator=(const thrower &) = default;
+    ~thrower() { --live; }
+};
+
+/**
+ * @brief 测试字段构造抛出异常时，已经构造的字段被销毁，容器保持不变
+ */
+TEST(SoaVectorTest, ThrowingFieldConstruct)
+{
+    {
+        soaVector<tracked, thrower> soa;
+        soa.emplace_back(1, 1);
+        EXPECT_THROW(soa.emplace_back(2, -1), std::runtime_error);
+        EXPECT_EQ(soa.size(), 1);
+        EXPECT_EQ(tracked::live, 1);
+        EXPECT_EQ(thrower::live, 1);
+
+        soa.emplace_back(3, 3);
+        EXPECT_EQ(std::get<0>(soa[1]).v, 3);
+        EXPECT_EQ(tracked::live, 2);
+    }
+    EXPECT_EQ(tracked::live, 0);
+    EXPECT_EQ(thrower::live, 0);
+}
+
+/**
+ * @brief 测试扩容时某一列拷贝抛出异常：新内存被释放，原数据保持不变
+ */
+TEST(SoaVectorTest, ThrowingReallocate)
+{
+    {
+        soaVector<tracked, thrower> soa;
+        soa.reserve(4);
+        for (int i = 0; i < 4; ++i)
+        {
+            soa.emplace_back(i, i);
+        }
+        thrower::copiesLeft = 2;
+        EXPECT_THROW(soa.emplace_back(4, 4), std::runtime_error);
+        thrower::copiesLeft = -1;
+        EXPECT_EQ(soa.size(), 4);
+        EXPECT_EQ(soa.capacity(), 4);
+        EXPECT_EQ(tracked::live, 4);
+        EXPECT_EQ(thrower::live, 4);
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_EQ(std::get<0>(soa[i]).v, i);
+            EXPECT_EQ(std::get<1>(soa[i]).v, i);
+        }
+
+        soa.emplace_back(4, 4);
+        EXPECT_EQ(soa.size(), 5);
+        EXPECT_EQ(std::get<1>(soa[4]).v, 4);
+    }
+    EXPECT_EQ(tracked::live, 0);
+    EXPECT_EQ(thrower::live, 0);
+}
+
+/**
+ * @brief 测试扩容时新行的参数引用已有的行
+ */
+TEST(SoaVectorTest, EmplaceBackAliasesExistingRow)
+{
+    soaVector<std::string, int> soa;
+    soa.push_back(std::string(40, 'x'), 1);
+    for (int i = 0; i < 5; ++i)
+    {
+        // 容量为 1、2、4 时都会扩容
+        soa.emplace_back(std::get<0>(soa[0]), std::get<1>(soa[soa.size() - 1]));
+    }
+    EXPECT_EQ(soa.size(), 6);
+    for (size_t i = 0; i < soa.size(); ++i)
+    {
+        EXPECT_EQ(std::get<0>(soa[i]), std::string(40, 'x'));
+        EXPECT_EQ(std::get<1>(soa[i]), 1);
+    }
+}
+
+/**
+ * @brief 测试容量上限和 resize 的几何增长
+ */
+TEST(SoaVectorTest, CapacityLimit)
+{
+    soaVector<uint64_t> soa;
+    EXPECT_THROW(soa.reserve(SIZE_MAX / 8 + 2), std::length_error);
+    EXPECT_THROW(soa.reserve(soaVector<uint64_t>::max_size() + 1), std::length_error);
+    EXPECT_THROW(soa.resize(SIZE_MAX), std::length_error);
+    EXPECT_EQ(soa.capacity(), 0);
+    soa.push_back(1);
+    EXPECT_EQ(std::get<0>(soa[0]), 1);
+
+    size_t reallocations = 0;
+    for (size_t i = 1; i < 1000; ++i)
+    {
+        size_t capacity = soa.capacity();
+        soa.resize(soa.size() + 1);
+        reallocations += soa.capacity() != capacity;
+    }
+    EXPECT_LE(reallocations, 11);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
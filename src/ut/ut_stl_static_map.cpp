@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "../stl_static_map.cpp"
+
+using namespace std::literals;
+
+constexpr auto kOpcodes = makeStaticMap<std::string_view, int>({
+    {"add", 1}, {"sub", 2}, {"mul", 3}, {"div", 4}, {"mod", 5},
+    {"and", 6}, {"or", 7}, {"xor", 8}, {"shl", 9}, {"shr", 10},
+});
+
+static_assert(kOpcodes.size() == 10);
+static_assert(kOpcodes["add"] == 1);
+static_assert(kOpcodes.at("shr") == 10);
+static_assert(kOpcodes.contains("xor"));
+static_assert(!kOpcodes.contains("nop"));
+static_assert(kOpcodes.find("jmp") == nullptr);
+
+/**
+ * @brief 编译期构造包含 2000 个键的表
+ */
+constexpr std::array<std::pair<uint32_t, uint32_t>, 2000> largeEntries()
+{
+    std::array<std::pair<uint32_t, uint32_t>, 2000> entries{};
+    for (uint32_t i = 0; i < entries.size(); ++i)
+    {
+        entries[i] = {i * 2654435761u, i};
+    }
+    return entries;
+}
+
+constexpr staticMap<uint32_t, uint32_t, 2000> kLarge(largeEntries());
+static_assert(kLarge.size() == 2000);
+static_assert(kLarge.at(0) == 0 && kLarge.at(1999u * 2654435761u) == 1999);
+static_assert(!kLarge.contains(1));
+
+/**
+ * @brief 测试编译期构造的查找表在运行期可用
+ */
+TEST(StaticMapTest, Constexpr)
+{
+    std::string key = "mul";
+    EXPECT_EQ(kOpcodes[key], 3);
+    EXPECT_EQ(*kOpcodes.find("mod"), 5);
+    EXPECT_THROW(kOpcodes.at("nop"), std::out_of_range);
+    EXPECT_THROW(kOpcodes["nop"], std::out_of_range);
+}
+
+/**
+ * @brief 测试整数键在较大的键集合下仍然每个键都能找到，并且不存在的键查不到
+ */
+TEST(StaticMapTest, IntegerKeys)
+{
+    std::array<std::pair<uint32_t, uint32_t>, 200> entries{};
+    for (uint32_t i = 0; i < entries.size(); ++i)
+    {
+        entries[i] = {i * 7919, i};
+    }
+    staticMap<uint32_t, uint32_t, 200> map(entries);
+    for (uint32_t i = 0; i < entries.size(); ++i)
+    {
+        EXPECT_EQ(map.at(i * 7919), i);
+    }
+    for (uint32_t i = 0; i < entries.size(); ++i)
+    {
+        EXPECT_FALSE(map.contains(i * 7919 + 1));
+    }
+}
+
+/**
+ * @brief 测试编译期构造的大表在运行期每个键都能找到
+ */
+TEST(StaticMapTest, LargeConstexpr)
+{
+    constexpr auto entries = largeEntries();
+    for (const auto &[key, value] : entries)
+    {
+        EXPECT_EQ(kLarge.at(key), value);
+    }
+}
+
+/**
+ * @brief 测试修改值和 erase
+ */
+TEST(StaticMapTest, ModifyAndErase)
+{
+    auto map = makeStaticMap<int, int>({{1, 10}, {2, 20}, {3, 30}});
+    map[2] = 21;
+    EXPECT_EQ(map.at(2), 21);
+    EXPECT_EQ(map.erase(2), 1);
+    EXPECT_EQ(map.erase(2), 0);
+    EXPECT_EQ(map.size(), 2);
+    EXPECT_FALSE(map.contains(2));
+    EXPECT_THROW(map[2], std::out_of_range);
+    EXPECT_EQ(map[3], 30);
+}
+
+/**
+ * @brief 测试重复的键
+ */
+TEST(StaticMapTest, DuplicateKey)
+{
+    EXPECT_THROW((makeStaticMap<int, int>({{1, 1}, {2, 2}, {1, 3}})), std::invalid_argument);
+    EXPECT_THROW((makeStaticMap<std::string_view, int>({{"a", 1}, {"a", 2}})), std::invalid_argument);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
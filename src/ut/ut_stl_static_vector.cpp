@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include <numeric>
+#include <stdexcept>
+#include "../stl_static_vector.cpp"
+
+/**
+ * @brief 编译期构造的查找表
+ */
+constexpr staticVector<int, 8> squares()
+{
+    staticVector<int, 8> v;
+    for (int i = 0; i < 6; ++i)
+    {
+        v.push_back(i * i);
+    }
+    v.erase(0, 1);
+    v.insert(0, -1);
+    return v;
+}
+
+constexpr staticVector<int, 8> kSquares = squares();
+static_assert(kSquares.size() == 6);
+static_assert(kSquares[0] == -1 && kSquares[5] == 25);
+static_assert(kSquares.at(3) == 9);
+static_assert(staticVector<int, 8>::capacity() == 8);
+
+/**
+ * @brief 测试编译期构造的结果在运行期可用
+ */
+TEST(StaticVectorTest, Constexpr)
+{
+    EXPECT_EQ(kSquares.size(), 6);
+    EXPECT_EQ(std::accumulate(kSquares.begin(), kSquares.end(), 0), -1 + 1 + 4 + 9 + 16 + 25);
+}
+
+/**
+ * @brief 测试 push_back、pop_back 和 insert
+ */
+TEST(StaticVectorTest, PushBackAndInsert)
+{
+    staticVector<int, 4> v{1, 2};
+    EXPECT_EQ(v.push_back(4), 0);
+    EXPECT_EQ(v.insert(2, 3), 0);
+    EXPECT_EQ(v.size(), 4);
+    for (size_t i = 0; i < v.size(); ++i)
+    {
+        EXPECT_EQ(v[i], static_cast<int>(i) + 1);
+    }
+    EXPECT_THROW(v.push_back(5), std::length_error);
+    EXPECT_THROW(v.emplace_back(5), std::length_error);
+    EXPECT_EQ(v.pop_back(), 0);
+    EXPECT_THROW(v.insert(5, 0), std::out_of_range);
+    EXPECT_EQ(v.size(), 3);
+}
+
+/**
+ * @brief 测试 erase 和越界检查
+ */
+TEST(StaticVectorTest, Erase)
+{
+    staticVector<int, 8> v{0, 1, 2, 3, 4, 5};
+    EXPECT_EQ(v.erase(1, 3), 0);
+    EXPECT_EQ(v.size(), 4);
+    EXPECT_EQ(v[0], 0);
+    EXPECT_EQ(v[1], 3);
+    EXPECT_EQ(v[3], 5);
+    EXPECT_THROW(v.erase(4, 5), std::out_of_range);
+    EXPECT_THROW(v.erase(2, 1), std::out_of_range);
+    EXPECT_THROW(v.at(4), std::out_of_range);
+}
+
+/**
+ * @brief 测试 resize
+ */
+TEST(StaticVectorTest, Resize)
+{
+    staticVector<int, 4> v{7, 8, 9};
+    EXPECT_EQ(v.resize(1), 0);
+    EXPECT_EQ(v.size(), 1);
+    EXPECT_EQ(v.resize(4), 0);
+    EXPECT_EQ(v[1], 0);
+    EXPECT_THROW(v.resize(5), std::length_error);
+    EXPECT_THROW((staticVector<int, 2>{1, 2, 3}), std::length_error);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
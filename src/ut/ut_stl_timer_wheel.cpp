@@ -0,0 +1,241 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include "../stl_timer_wheel.cpp"
+
+/**
+ * @brief 测试定时器在到期时触发，且不会提前触发
+ */
+TEST(TimerWheelTest, ExpireAtDeadline)
+{
+    timerWheel<int> tw;
+    tw.schedule(10, 1);
+    tw.schedule(20, 2);
+
+    EXPECT_EQ(tw.advance(9), 0);
+    vector<int> fired;
+    EXPECT_EQ(tw.advance(10, [&](vector<int> &batch)
+                         { fired = batch; }),
+              1);
+    EXPECT_EQ(fired, vector<int>{1});
+    EXPECT_EQ(tw.size(), 1);
+
+    EXPECT_EQ(tw.advance(20), 1);
+    EXPECT_TRUE(tw.empty());
+}
+
+/**
+ * @brief 测试批量回调按到期顺序一次性传入所有到期数据
+ */
+TEST(TimerWheelTest, BatchCallbackOrder)
+{
+    timerWheel<int> tw;
+    tw.schedule(300, 3);
+    tw.schedule(5, 1);
+    tw.schedule(70000, 4);
+    tw.schedule(100, 2);
+
+    int calls = 0;
+    vector<int> fired;
+    tw.advance(100000, [&](vector<int> &batch)
+               { ++calls; fired = batch; });
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(fired, (vector<int>{1, 2, 3, 4}));
+}
+
+/**
+ * @brief 测试取消定时器，以及取消已触发或重复取消的句柄
+ */
+TEST(TimerWheelTest, Cancel)
+{
+    timerWheel<int> tw;
+    auto a = tw.schedule(10, 1);
+    auto b = tw.schedule(10, 2);
+    EXPECT_TRUE(tw.cancel(a));
+    EXPECT_FALSE(tw.cancel(a));
+    EXPECT_EQ(tw.size(), 1);
+
+    vector<int> fired;
+    tw.advance(10, [&](vector<int> &batch)
+               { fired = batch; });
+    EXPECT_EQ(fired, vector<int>{2});
+    EXPECT_FALSE(tw.cancel(b));
+
+    // 节点复用后旧句柄不能取消新定时器
+    auto c = tw.schedule(20, 3);
+    EXPECT_FALSE(tw.cancel(a));
+    EXPECT_TRUE(tw.cancel(c));
+}
+
+/**
+ * @brief 测试 tick 精度：到期时间向上取整
+ */
+TEST(TimerWheelTest, Resolution)
+{
+    timerWheel<int> tw(10, 1000);
+    tw.schedule(1005, 1);
+    EXPECT_EQ(tw.advance(1009), 0);
+    EXPECT_EQ(tw.advance(1010), 1);
+
+    // 过期的 deadline 在下一个 tick 触发
+    tw.schedule(500, 2);
+    EXPECT_EQ(tw.advance(1019), 0);
+    EXPECT_EQ(tw.advance(1020), 1);
+}
+
+/**
+ * @brief 测试 resolution 为 0 时抛出异常
+ */
+TEST(TimerWheelTest, ZeroResolution)
+{
+    EXPECT_THROW(timerWheel<int>(0), std::invalid_argument);
+}
+
+/**
+ * @brief 测试超出时间轮范围的定时器进入溢出堆，并能被取消
+ */
+TEST(TimerWheelTest, OverflowHeap)
+{
+    // 2 层时间轮只能容纳 65536 个 tick
+    timerWheel<int, 2> tw;
+    tw.schedule(100000, 1);
+    auto b = tw.schedule(200000, 2);
+    tw.schedule(300000, 3);
+    EXPECT_TRUE(tw.cancel(b));
+
+    EXPECT_EQ(tw.advance(99999), 0);
+    vector<int> fired;
+    tw.advance(1000000, [&](vector<int> &batch)
+               { fired = batch; });
+    EXPECT_EQ(fired, (vector<int>{1, 3}));
+    EXPECT_TRUE(tw.empty());
+}
+
+/**
+ * @brief 随机调度、取消、推进，与排序后的结果对比
+ */
+TEST(TimerWheelTest, RandomAgainstReference)
+{
+    timerWheel<uint64_t, 2> tw;
+    std::mt19937_64 rng(42);
+    vector<std::pair<uint64_t, uint64_t>> expected; ///< (deadline, payload)
+    vector<std::pair<timerWheel<uint64_t, 2>::timerId, size_t>> ids;
+    vector<bool> cancelled;
+    uint64_t now = 0;
+    vector<uint64_t> fired;
+    for (uint64_t i = 0; i < 20000; ++i)
+    {
+        uint64_t deadline = now + 1 + rng() % 200000;
+        ids.emplace_back(tw.schedule(deadline, i), expected.size());
+        expected.emplace_back(deadline, i);
+        cancelled.push_back(false);
+        if (rng() % 2 == 0)
+        {
+            size_t k = rng() % ids.size();
+            if (tw.cancel(ids[k].first))
+            {
+                cancelled[ids[k].second] = true;
+            }
+        }
+        if (rng() % 8 == 0)
+        {
+            now += rng() % 3000;
+            tw.advance(now, [&](vector<uint64_t> &batch)
+                       {
+                           for (uint64_t v : batch)
+                           {
+                               EXPECT_LE(expected[v].first, now);
+                           }
+                           fired.insert(fired.end(), batch.begin(), batch.end()); });
+        }
+    }
+    tw.advance(UINT64_MAX, [&](vector<uint64_t> &batch)
+               { fired.insert(fired.end(), batch.begin(), batch.end()); });
+    EXPECT_TRUE(tw.empty());
+
+    vector<uint64_t> want;
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        if (!cancelled[i])
+        {
+            want.push_back(expected[i].second);
+        }
+    }
+    std::sort(want.begin(), want.end());
+    std::sort(fired.begin(), fired.end());
+    EXPECT_EQ(fired, want);
+}
+
+/**
+ * @brief 测试推进很长的时间：只在有事件的 tick 上停下，不逐个 tick 推进
+ */
+TEST(TimerWheelTest, AdvanceSkipsEmptyTicks)
+{
+    timerWheel<int> tw;
+    tw.schedule(1ULL << 30, 1);
+    tw.schedule((1ULL << 30) + 5, 2);
+    tw.schedule(1ULL << 40, 3); // 超出 4 层时间轮的范围
+    EXPECT_EQ(tw.advance((1ULL << 30) - 1), 0);
+    vector<int> fired;
+    auto collect = [&](vector<int> &batch)
+    { fired.insert(fired.end(), batch.begin(), batch.end()); };
+    EXPECT_EQ(tw.advance(1ULL << 30, collect), 1);
+    EXPECT_EQ(tw.advance((1ULL << 40) - 1, collect), 1);
+    EXPECT_EQ(tw.advance(1ULL << 40, collect), 1);
+    EXPECT_EQ(fired, (vector<int>{1, 2, 3}));
+    EXPECT_EQ(tw.currentTick(), 1ULL << 40);
+    EXPECT_TRUE(tw.empty());
+}
+
+/**
+ * @brief 随机调度、取消、长距离推进，每次推进后触发的集合必须恰好是已到期且未取消的定时器
+ */
+TEST(TimerWheelTest, RandomSparseExact)
+{
+    // 3 层时间轮容纳 2^24 个 tick，截止时间最远到 2^26，覆盖级联和溢出堆
+    timerWheel<uint64_t, 3> tw;
+    std::mt19937_64 rng(7);
+    vector<uint64_t> deadlines;
+    vector<timerWheel<uint64_t, 3>::timerId> ids;
+    vector<bool> pending;
+    uint64_t now = 0;
+    for (int round = 0; round < 2000; ++round)
+    {
+        uint64_t deadline = now + 1 + rng() % (1ULL << (rng() % 27));
+        ids.push_back(tw.schedule(deadline, deadlines.size()));
+        deadlines.push_back(deadline);
+        pending.push_back(true);
+        if (rng() % 4 == 0)
+        {
+            size_t k = rng() % ids.size();
+            if (tw.cancel(ids[k]))
+            {
+                pending[k] = false;
+            }
+        }
+        if (rng() % 2 == 0)
+        {
+            now += rng() % (1ULL << (rng() % 25));
+            vector<uint64_t> fired;
+            tw.advance(now, [&](vector<uint64_t> &batch)
+                       { fired = batch; });
+            vector<uint64_t> want;
+            for (size_t i = 0; i < deadlines.size(); ++i)
+            {
+                if (pending[i] && deadlines[i] <= now)
+                {
+                    want.push_back(i);
+                    pending[i] = false;
+                }
+            }
+            std::sort(fired.begin(), fired.end());
+            ASSERT_EQ(fired, want);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
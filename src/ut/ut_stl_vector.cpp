@@ -131,11 +131,11 @@ TEST(VectorWarpperTest, CopyConstructorDeleted)
 }
 
 /**
- * @brief 测试移动构造被删除
+ * @brief 测试移动构造不抛出异常
  */
-TEST(VectorWarpperTest, MoveConstructorDeleted)
+TEST(VectorWarpperTest, MoveConstructorNoexcept)
 {
-    EXPECT_FALSE(std::is_move_constructible<vectorWarpper<int>>::value);
+    EXPECT_TRUE(std::is_nothrow_move_constructible<vectorWarpper<int>>::value);
 }
 
 /**
@@ -147,11 +147,36 @@ TEST(VectorWarpperTest, CopyAssignmentDeleted)
 }
 
 /**
- * @brief 测试移动赋值被删除
+ * @brief 测试移动赋值不抛出异常
  */
-TEST(VectorWarpperTest, MoveAssignmentDeleted)
+TEST(VectorWarpperTest, MoveAssignmentNoexcept)
 {
-    EXPECT_FALSE(std::is_move_assignable<vectorWarpper<int>>::value);
+    EXPECT_TRUE(std::is_nothrow_move_assignable<vectorWarpper<int>>::value);
+}
+
+/**
+ * @brief 测试移动后元素被转移，并且可以放入其他容器中
+ */
+TEST(VectorWarpperTest, Move)
+{
+    vectorWarpper<int> vw1;
+    vw1.push_back(1);
+    vw1.push_back(2);
+
+    vectorWarpper<int> vw2(std::move(vw1));
+    EXPECT_EQ(vw2.size(), 2);
+    EXPECT_EQ(vw2[1], 2);
+
+    vectorWarpper<int> vw3(5);
+    vw3 = std::move(vw2);
+    EXPECT_EQ(vw3.size(), 2);
+    EXPECT_EQ(vw3[0], 1);
+
+    std::vector<vectorWarpper<int>> nested;
+    nested.push_back(std::move(vw3));
+    nested.emplace_back(3);
+    EXPECT_EQ(nested[0][1], 2);
+    EXPECT_EQ(nested[1].size(), 3);
 }
 
 int main(int argc, char **argv)